@@ -0,0 +1,167 @@
+// Headless reference implementation of the DoF post pass.
+// Runs the CPU SAT + box filter (or a higher order kernel from an iterated SAT) over image/depth file pairs, writes the results, and reports the throughput.
+
+#include "cpu_dof.h"
+#include "image_io.h"
+#include "preamble.glsl"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static void PrintUsage()
+{
+    fprintf(stderr,
+        "usage: dofref [options] color depth.pfm output.ppm [color depth.pfm output.ppm ...]\n"
+        "\n"
+        "  color       8-bit sRGB image (PNG, TGA, BMP, PPM, ...)\n"
+        "  depth.pfm   reversed-Z depth buffer (1 at the near plane, 0 infinitely far)\n"
+        "  output.ppm  the blurred image\n"
+        "\n"
+        "options:\n"
+        "  --znear <z>       near plane distance (default 0.01)\n"
+        "  --focus <f>       focus depth (default 5.0)\n"
+        "  --kernel <k>      box, tent or quadratic (default box)\n"
+        "  --iterations <n>  number of times the DoF is applied to measure the throughput (default 1)\n");
+}
+
+extern "C"
+int main(int argc, char* argv[])
+{
+    float zNear = 0.01f;
+    float focus = 5.0f;
+    int iterations = 1;
+    int kernel = DOF_KERNEL_BOX;
+
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--znear") == 0 && i + 1 < argc)
+        {
+            zNear = (float)atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--focus") == 0 && i + 1 < argc)
+        {
+            focus = (float)atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--kernel") == 0 && i + 1 < argc)
+        {
+            const char* name = argv[++i];
+            if (strcmp(name, "box") == 0)
+            {
+                kernel = DOF_KERNEL_BOX;
+            }
+            else if (strcmp(name, "tent") == 0)
+            {
+                kernel = DOF_KERNEL_TENT;
+            }
+            else if (strcmp(name, "quadratic") == 0)
+            {
+                kernel = DOF_KERNEL_QUADRATIC;
+            }
+            else
+            {
+                PrintUsage();
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+        {
+            iterations = atoi(argv[++i]);
+        }
+        else if (argv[i][0] == '-')
+        {
+            PrintUsage();
+            return 1;
+        }
+        else
+        {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (files.empty() || files.size() % 3 != 0 || iterations < 1)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    int failures = 0;
+    double totalMegapixels = 0.0;
+    double totalSeconds = 0.0;
+
+    for (size_t fileIdx = 0; fileIdx < files.size(); fileIdx += 3)
+    {
+        const char* colorFilename = files[fileIdx + 0];
+        const char* depthFilename = files[fileIdx + 1];
+        const char* outputFilename = files[fileIdx + 2];
+
+        std::vector<glm::u8vec4> color;
+        int colorWidth, colorHeight;
+        std::vector<float> depth;
+        int depthWidth, depthHeight;
+        if (!LoadImageRGBA8(colorFilename, &color, &colorWidth, &colorHeight) ||
+            !LoadImagePFM(depthFilename, &depth, &depthWidth, &depthHeight))
+        {
+            failures++;
+            continue;
+        }
+
+        if (colorWidth != depthWidth || colorHeight != depthHeight)
+        {
+            fprintf(stderr, "%s is %dx%d but %s is %dx%d\n",
+                colorFilename, colorWidth, colorHeight,
+                depthFilename, depthWidth, depthHeight);
+            failures++;
+            continue;
+        }
+
+        int width = colorWidth;
+        int height = colorHeight;
+
+        // the higher order kernels blur from an iterated SAT, padded past the image
+        std::vector<glm::uvec4> sat(width * height);
+        if (kernel != DOF_KERNEL_BOX)
+        {
+            sat.resize((width + SAT_ITERATED_PADDING) * (height + SAT_ITERATED_PADDING));
+        }
+        std::vector<glm::u8vec4> output(width * height);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iteration = 0; iteration < iterations; iteration++)
+        {
+            if (kernel == DOF_KERNEL_BOX)
+            {
+                ApplyDepthOfFieldCPU(color.data(), depth.data(), width, height, zNear, focus, sat.data(), output.data());
+            }
+            else
+            {
+                ApplyDepthOfFieldKernelCPU(color.data(), depth.data(), width, height, zNear, focus, kernel, sat.data(), output.data());
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        double megapixels = (double)width * height * iterations / 1000000.0;
+        totalSeconds += seconds;
+        totalMegapixels += megapixels;
+
+        printf("%s: %dx%d, %.3f ms per frame, %.2f megapixels/second\n",
+            colorFilename, width, height,
+            seconds * 1000.0 / iterations, megapixels / seconds);
+
+        if (!SaveImagePPM(outputFilename, output.data(), width, height))
+        {
+            failures++;
+        }
+    }
+
+    if (totalSeconds > 0.0)
+    {
+        printf("total: %.2f megapixels/second\n", totalMegapixels / totalSeconds);
+    }
+
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,389 @@
+// Headless focus stack renderer.
+// Builds the SAT of an image once on the GPU, then runs the DoF pass (dof.frag) for every focus depth of a list or range,
+// since only the DoF depends on the focus. Each result is read back through a ring of PBOs and written to disk by a writer thread,
+// so the GPU keeps blurring while the files are written.
+// eg. from the viewer directory, for the shaders: focusstack --range 1 50 100 color.png depth.pfm focus_%03d.ppm
+
+#include "gpu_sat.h"
+#include "headless_gl.h"
+#include "image_io.h"
+#include "shaderset.h"
+#include "opengl.h"
+#include "preamble.glsl"
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The number of readbacks in flight. The oldest one is written to disk when the ring wraps around.
+static const int kReadbackRingSize = 3;
+
+static void PrintUsage()
+{
+    fprintf(stderr,
+        "usage: focusstack [options] color depth.pfm output\n"
+        "\n"
+        "  color       8-bit sRGB image (PNG, TGA, BMP, PPM, ...)\n"
+        "  depth.pfm   reversed-Z depth buffer (1 at the near plane, 0 infinitely far)\n"
+        "  output      printf pattern of the blurred images, given the index of their focus depth (eg. focus_%%03d.ppm)\n"
+        "\n"
+        "options:\n"
+        "  --znear <z>                     near plane distance (default 0.01)\n"
+        "  --focus <f>                     adds a focus depth, can be repeated\n"
+        "  --range <first> <last> <count>  adds count focus depths evenly spaced from first to last (a focus pull)\n");
+}
+
+// Writes images to disk on a background thread, in the order they were queued.
+class ImageWriter
+{
+    struct Job
+    {
+        std::string Filename;
+        std::vector<glm::u8vec4> Pixels;
+        int Width;
+        int Height;
+    };
+
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+
+    bool mQuit;
+    std::deque<Job> mJobs;
+    int mFailures;
+
+    void ThreadMain()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true)
+        {
+            mCondition.wait(lock, [this] { return !mJobs.empty() || mQuit; });
+            if (mJobs.empty())
+            {
+                break;
+            }
+
+            // write outside the lock, so more jobs can be queued meanwhile.
+            Job job = std::move(mJobs.front());
+            mJobs.pop_front();
+            lock.unlock();
+            bool saved = SaveImagePPM(job.Filename.c_str(), job.Pixels.data(), job.Width, job.Height);
+            lock.lock();
+
+            if (!saved)
+            {
+                mFailures++;
+            }
+        }
+    }
+
+public:
+    ImageWriter()
+    {
+        mQuit = false;
+        mFailures = 0;
+        mThread = std::thread([this] { ThreadMain(); });
+    }
+
+    // Writes the queued images, then stops the thread.
+    ~ImageWriter()
+    {
+        Finish();
+    }
+
+    void Write(const std::string& filename, std::vector<glm::u8vec4> pixels, int width, int height)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mJobs.push_back(Job{ filename, std::move(pixels), width, height });
+        }
+        mCondition.notify_all();
+    }
+
+    // Writes the queued images, then stops the thread. Returns the number of images that failed to be written.
+    int Finish()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mQuit = true;
+        }
+        mCondition.notify_all();
+        if (mThread.joinable())
+        {
+            mThread.join();
+        }
+        return mFailures;
+    }
+};
+
+extern "C"
+int main(int argc, char* argv[])
+{
+    float zNear = 0.01f;
+    std::vector<float> focusDepths;
+
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--znear") == 0 && i + 1 < argc)
+        {
+            zNear = (float)atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--focus") == 0 && i + 1 < argc)
+        {
+            focusDepths.push_back((float)atof(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--range") == 0 && i + 3 < argc)
+        {
+            float first = (float)atof(argv[++i]);
+            float last = (float)atof(argv[++i]);
+            int count = atoi(argv[++i]);
+            if (count < 1)
+            {
+                PrintUsage();
+                return 1;
+            }
+            for (int focusIdx = 0; focusIdx < count; focusIdx++)
+            {
+                float t = count == 1 ? 0.0f : (float)focusIdx / (count - 1);
+                focusDepths.push_back(first + (last - first) * t);
+            }
+        }
+        else if (argv[i][0] == '-')
+        {
+            PrintUsage();
+            return 1;
+        }
+        else
+        {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (files.size() != 3 || focusDepths.empty() || !strchr(files[2], '%'))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    const char* colorFilename = files[0];
+    const char* depthFilename = files[1];
+    const char* outputPattern = files[2];
+
+    std::vector<glm::u8vec4> color;
+    int colorWidth, colorHeight;
+    std::vector<float> depth;
+    int depthWidth, depthHeight;
+    if (!LoadImageRGBA8(colorFilename, &color, &colorWidth, &colorHeight) ||
+        !LoadImagePFM(depthFilename, &depth, &depthWidth, &depthHeight))
+    {
+        return 1;
+    }
+
+    if (colorWidth != depthWidth || colorHeight != depthHeight)
+    {
+        fprintf(stderr, "%s is %dx%d but %s is %dx%d\n",
+            colorFilename, colorWidth, colorHeight,
+            depthFilename, depthWidth, depthHeight);
+        return 1;
+    }
+
+    int width = colorWidth;
+    int height = colorHeight;
+
+    if (!CreateHeadlessGLContext("focusstack"))
+    {
+        return 1;
+    }
+
+    int failures;
+    // the shaders are deleted at the end of the scope, before the context is destroyed
+    {
+        ShaderSet shaders;
+        shaders.SetVersion("440");
+        shaders.SetPreambleFile("preamble.glsl");
+        GPUSAT gpuSAT = {};
+        gpuSAT.Init(&shaders, GetDefaultSATWorkgroupSizes());
+        GLuint* depthOfFieldSP = shaders.AddProgramFromExts({ "blit.vert", "dof.frag" }, GetSATFormatDefines(SATFormat_RGBA32UI));
+        shaders.UpdatePrograms();
+
+        if (!*depthOfFieldSP)
+        {
+            fprintf(stderr, "Failed to compile the DoF shaders. focusstack must be run from the viewer directory.\n");
+            return 1;
+        }
+
+        // same formats as the backbuffer
+        GLuint colorTO;
+        glGenTextures(1, &colorTO);
+        glBindTexture(GL_TEXTURE_2D, colorTO);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_SRGB8_ALPHA8, width, height);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, color.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        GLuint depthTO;
+        glGenTextures(1, &depthTO);
+        glBindTexture(GL_TEXTURE_2D, depthTO);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH_COMPONENT32F, width, height);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_DEPTH_COMPONENT, GL_FLOAT, depth.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        // The DoF is drawn in place over a copy of the image, like over the backbuffer in the viewer.
+        GLuint outputTO;
+        glGenTextures(1, &outputTO);
+        glBindTexture(GL_TEXTURE_2D, outputTO);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_SRGB8_ALPHA8, width, height);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        GLuint outputFBO;
+        glGenFramebuffers(1, &outputFBO);
+        glBindFramebuffer(GL_FRAMEBUFFER, outputFBO);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, outputTO, 0);
+        GLenum fboStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        if (fboStatus != GL_FRAMEBUFFER_COMPLETE)
+        {
+            fprintf(stderr, "glCheckFramebufferStatus: %x\n", fboStatus);
+            return 1;
+        }
+
+        GLuint readbackPBOs[kReadbackRingSize];
+        GLsync readbackFences[kReadbackRingSize] = {};
+        glGenBuffers(kReadbackRingSize, &readbackPBOs[0]);
+        for (int i = 0; i < kReadbackRingSize; i++)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackPBOs[i]);
+            glBufferStorage(GL_PIXEL_PACK_BUFFER, width * height * sizeof(glm::u8vec4), NULL, GL_MAP_READ_BIT);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        GLuint nullVAO;
+        glGenVertexArrays(1, &nullVAO);
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        // The SAT only depends on the image, so it's built once for all the focus depths.
+        gpuSAT.Resize(width, height, SATFormat_RGBA32UI);
+        if (!gpuSAT.Compute(colorTO, SATAlgorithm_UpDownSweep, SATColumnPass_InPlace))
+        {
+            fprintf(stderr, "Failed to compile the SAT shaders. focusstack must be run from the viewer directory.\n");
+            return 1;
+        }
+        glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+
+        ImageWriter writer;
+
+        // Maps the readback of the focus depth, and queues it to be written.
+        auto writeReadback = [&](int focusIdx)
+        {
+            int readbackIndex = focusIdx % kReadbackRingSize;
+
+            GLenum waitStatus;
+            do
+            {
+                waitStatus = glClientWaitSync(readbackFences[readbackIndex], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            } while (waitStatus == GL_TIMEOUT_EXPIRED);
+            glDeleteSync(readbackFences[readbackIndex]);
+            readbackFences[readbackIndex] = 0;
+
+            std::vector<glm::u8vec4> pixels(width * height);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackPBOs[readbackIndex]);
+            const glm::u8vec4* mapped = (const glm::u8vec4*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, width * height * sizeof(glm::u8vec4), GL_MAP_READ_BIT);
+            if (mapped)
+            {
+                memcpy(pixels.data(), mapped, width * height * sizeof(glm::u8vec4));
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            else
+            {
+                fprintf(stderr, "glMapBufferRange: failed to map the readback of focus depth %g\n", focusDepths[focusIdx]);
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+            char filename[1024];
+            snprintf(filename, sizeof(filename), outputPattern, focusIdx);
+            writer.Write(filename, std::move(pixels), width, height);
+        };
+
+        glBindFramebuffer(GL_FRAMEBUFFER, outputFBO);
+        glViewport(0, 0, width, height);
+        glBindVertexArray(nullVAO);
+        GLuint satTO = gpuSAT.GetSATTexture();
+        glBindTextures(DOF_SAT_TEXTURE_BINDING, 1, &satTO);
+        glBindTextures(DOF_DEPTH_TEXTURE_BINDING, 1, &depthTO);
+        glUseProgram(*depthOfFieldSP);
+        glUniform1f(DOF_ZNEAR_UNIFORM_LOCATION, zNear);
+        // only the full resolution SAT is built
+        glUniform1i(DOF_SAT_LEVELS_UNIFORM_LOCATION, 1);
+        glUniform1i(DOF_SAT_INCLUSIVE_UNIFORM_LOCATION, 0);
+
+        for (int focusIdx = 0; focusIdx < (int)focusDepths.size(); focusIdx++)
+        {
+            // the slot of the ring is free once the focus depth that last used it is written
+            if (focusIdx >= kReadbackRingSize)
+            {
+                writeReadback(focusIdx - kReadbackRingSize);
+            }
+
+            // the background is discarded by the DoF, so it keeps the image's color
+            glCopyImageSubData(
+                colorTO, GL_TEXTURE_2D, 0, 0, 0, 0,
+                outputTO, GL_TEXTURE_2D, 0, 0, 0, 0,
+                width, height, 1);
+
+            glEnable(GL_FRAMEBUFFER_SRGB);
+            glUniform1f(DOF_FOCUS_UNIFORM_LOCATION, focusDepths[focusIdx]);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+            glDisable(GL_FRAMEBUFFER_SRGB);
+
+            int readbackIndex = focusIdx % kReadbackRingSize;
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackPBOs[readbackIndex]);
+            glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            readbackFences[readbackIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+
+        for (int focusIdx = std::max((int)focusDepths.size() - kReadbackRingSize, 0); focusIdx < (int)focusDepths.size(); focusIdx++)
+        {
+            writeReadback(focusIdx);
+        }
+
+        glUseProgram(0);
+        glBindTextures(DOF_SAT_TEXTURE_BINDING, 1, NULL);
+        glBindTextures(DOF_DEPTH_TEXTURE_BINDING, 1, NULL);
+        glBindVertexArray(0);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        auto renderEnd = std::chrono::high_resolution_clock::now();
+        failures = writer.Finish();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double renderSeconds = std::chrono::duration<double>(renderEnd - start).count();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        printf("%s: %dx%d, %d focus depths, %.3f ms per focus depth rendered, %.3f ms per focus depth written\n",
+            colorFilename, width, height, (int)focusDepths.size(),
+            renderSeconds * 1000.0 / focusDepths.size(), seconds * 1000.0 / focusDepths.size());
+
+        glDeleteVertexArrays(1, &nullVAO);
+        glDeleteBuffers(kReadbackRingSize, &readbackPBOs[0]);
+        glDeleteFramebuffers(1, &outputFBO);
+        glDeleteTextures(1, &outputTO);
+        glDeleteTextures(1, &depthTO);
+        glDeleteTextures(1, &colorTO);
+        gpuSAT.Release();
+    }
+
+    DestroyHeadlessGLContext();
+
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
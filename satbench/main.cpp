@@ -0,0 +1,541 @@
+// Benchmark of the summed area table (SAT) construction.
+// Times every CPU and GPU implementation of the SAT at common resolutions, and writes the results as JSON.
+// The shaders are loaded from the current directory, so it's run from the viewer directory.
+
+#include "cpu_sat.h"
+#include "gpu_sat.h"
+#include "headless_gl.h"
+#include "shaderset.h"
+#include "opengl.h"
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Resolution
+{
+    const char* Name;
+    int Width;
+    int Height;
+};
+
+static const Resolution kResolutions[] = {
+    { "720p", 1280, 720 },
+    { "1080p", 1920, 1080 },
+    { "1440p", 2560, 1440 },
+    { "4K", 3840, 2160 },
+    { "8K", 7680, 4320 },
+};
+
+// names of the SAT formats in the JSON results
+static const char* kSATFormatNames[SATFormat_Count] = {
+    "RGBA32UI",
+    "RG32UI_COMPACT",
+    "RGBA32UI_HDR_TILED"
+};
+
+// implementation names of the GPU SAT algorithms in the JSON results
+static const char* kGPUAlgorithmNames[SATAlgorithm_Count] = {
+    "gpu",
+    "gpu_lookback",
+    "gpu_subgroup",
+    "gpu_padded"
+};
+
+// names of the GPU SAT column passes in the JSON results
+static const char* kSATColumnPassNames[SATColumnPass_Count] = {
+    "in_place",
+    "transpose",
+    "tiled_transpose"
+};
+
+struct BenchmarkResult
+{
+    std::string Implementation;
+    const Resolution* Res;
+    SATFormat Format;
+    // SATColumnPass of the GPU implementations, -1 for the CPU ones
+    int ColumnPass;
+    // sorted, in milliseconds
+    std::vector<double> Samples;
+};
+
+struct BenchmarkOptions
+{
+    int Iterations;
+    int WarmupIterations;
+    bool SkipCPU;
+    bool SkipGPU;
+    bool SkipReference;
+};
+
+static void PrintUsage()
+{
+    fprintf(stderr,
+        "usage: satbench [options]\n"
+        "\n"
+        "options:\n"
+        "  --iterations <n>  timed iterations per implementation and resolution (default 20)\n"
+        "  --warmup <n>      untimed iterations run first (default 3)\n"
+        "  --output <file>   write the JSON results to a file instead of stdout\n"
+        "  --skip-cpu        don't benchmark the CPU implementations\n"
+        "  --skip-gpu        don't benchmark the GPU implementations\n"
+        "  --skip-reference  don't benchmark the (slow) single-threaded CPU reference\n");
+}
+
+// Nearest-rank percentile of sorted samples
+static double Percentile(const std::vector<double>& samples, double percentile)
+{
+    int rank = (int)std::ceil(percentile / 100.0 * samples.size());
+    rank = std::min(std::max(rank, 1), (int)samples.size());
+    return samples[rank - 1];
+}
+
+// The HDR SAT is built from an RGBA16F image, like the HDR backbuffer. The others from an 8-bit sRGB image.
+static const char* GetInputFormatName(SATFormat format)
+{
+    return format == SATFormat_HDR ? "RGBA16F" : "SRGB8_ALPHA8";
+}
+
+// Minimum memory traffic of a SAT: reading every input texel once and writing every SAT texel once.
+// Dividing it by the time gives a bandwidth that can be compared against the peak of the hardware.
+static double GetSATBytes(int width, int height, SATFormat format)
+{
+    size_t inputTexelSize = format == SATFormat_HDR ? sizeof(glm::u16vec4) : sizeof(glm::u8vec4);
+    size_t satTexelSize = format == SATFormat_Compact ? sizeof(uint64_t) : sizeof(glm::uvec4);
+    return (double)width * height * (inputTexelSize + satTexelSize);
+}
+
+static std::string EscapeJSON(const char* s)
+{
+    std::string escaped;
+    for (; *s; s++)
+    {
+        if (*s == '"' || *s == '\\')
+        {
+            escaped += '\\';
+            escaped += *s;
+        }
+        else if ((unsigned char)*s < 0x20)
+        {
+            char buf[8];
+            sprintf(buf, "\\u%04x", *s);
+            escaped += buf;
+        }
+        else
+        {
+            escaped += *s;
+        }
+    }
+    return escaped;
+}
+
+static void BenchmarkCPU(
+    const BenchmarkOptions& options,
+    const Resolution& res,
+    const std::vector<glm::u8vec4>& image,
+    std::vector<BenchmarkResult>* results)
+{
+    static const char* kISANames[CPUSATKernelISA_Count] = {
+        "cpu_scalar",
+        "cpu_sse41",
+        "cpu_avx2"
+    };
+
+    std::vector<glm::uvec4> sat(res.Width * res.Height);
+    // the compact SAT is half the size, so it fits in the same memory
+    uint64_t* compactSAT = (uint64_t*)sat.data();
+
+    // -1 is the reference, CPUSATKernelISA_Count is the compact format,
+    // and the rest are the parallel implementation with each kernel ISA.
+    for (int isa = -1; isa <= CPUSATKernelISA_Count; isa++)
+    {
+        if (isa == -1 && options.SkipReference)
+        {
+            continue;
+        }
+
+        bool compact = isa == CPUSATKernelISA_Count;
+
+        if (isa != -1 && !compact && !IsCPUSATKernelISASupported((CPUSATKernelISA)isa))
+        {
+            fprintf(stderr, "%s: %s is not supported by this CPU, skipped\n", res.Name, kISANames[isa]);
+            continue;
+        }
+
+        BenchmarkResult result;
+        result.Implementation = isa == -1 ? "cpu_reference" : compact ? "cpu_compact" : kISANames[isa];
+        result.Res = &res;
+        result.Format = compact ? SATFormat_Compact : SATFormat_RGBA32UI;
+        result.ColumnPass = -1;
+
+        fprintf(stderr, "%s: %s\n", res.Name, result.Implementation.c_str());
+
+        for (int iteration = 0; iteration < options.WarmupIterations + options.Iterations; iteration++)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            if (isa == -1)
+            {
+                ComputeSummedAreaTableCPUReference(image.data(), res.Width, res.Height, sat.data(), res.Width);
+            }
+            else if (compact)
+            {
+                ComputeCompactSummedAreaTableCPU(image.data(), res.Width, res.Height, compactSAT, res.Width);
+            }
+            else
+            {
+                ComputeSummedAreaTableCPU(image.data(), res.Width, res.Height, sat.data(), res.Width, (CPUSATKernelISA)isa);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+
+            if (iteration >= options.WarmupIterations)
+            {
+                result.Samples.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+            }
+        }
+
+        std::sort(result.Samples.begin(), result.Samples.end());
+        results->push_back(result);
+    }
+}
+
+// Times the GPU SAT built from inputTO, into the samples of the result. Returns false if the SAT programs failed to compile.
+static bool TimeGPU(
+    const BenchmarkOptions& options,
+    GLuint inputTO,
+    SATAlgorithm algorithm,
+    SATColumnPass columnPass,
+    GPUSAT* gpuSAT,
+    const std::vector<GLuint>& queries,
+    BenchmarkResult* result)
+{
+    for (int iteration = 0; iteration < options.WarmupIterations + options.Iterations; iteration++)
+    {
+        int timedIteration = iteration - options.WarmupIterations;
+
+        if (timedIteration >= 0)
+        {
+            glQueryCounter(queries[timedIteration * 2 + 0], GL_TIMESTAMP);
+        }
+
+        if (!gpuSAT->Compute(inputTO, algorithm, columnPass))
+        {
+            fprintf(stderr, "Failed to compile the SAT shaders. satbench must be run from the viewer directory.\n");
+            return false;
+        }
+
+        if (timedIteration >= 0)
+        {
+            glQueryCounter(queries[timedIteration * 2 + 1], GL_TIMESTAMP);
+        }
+    }
+
+    for (int iteration = 0; iteration < options.Iterations; iteration++)
+    {
+        GLuint64 start, end;
+        glGetQueryObjectui64v(queries[iteration * 2 + 0], GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(queries[iteration * 2 + 1], GL_QUERY_RESULT, &end);
+        result->Samples.push_back((end - start) / 1000000.0);
+    }
+
+    std::sort(result->Samples.begin(), result->Samples.end());
+    return true;
+}
+
+// Returns false if the SAT programs failed to compile.
+static bool BenchmarkGPU(
+    const BenchmarkOptions& options,
+    const Resolution& res,
+    const std::vector<glm::u8vec4>& image,
+    GPUSAT* gpuSAT,
+    std::vector<BenchmarkResult>* results)
+{
+    // same format as the backbuffer
+    GLuint inputTO;
+    glGenTextures(1, &inputTO);
+    glBindTexture(GL_TEXTURE_2D, inputTO);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_SRGB8_ALPHA8, res.Width, res.Height);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, res.Width, res.Height, GL_RGBA, GL_UNSIGNED_BYTE, image.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    std::vector<GLuint> queries(options.Iterations * 2);
+    glGenQueries((GLsizei)queries.size(), queries.data());
+
+    bool compiled = true;
+    for (int format = 0; format < SATFormat_Count && compiled; format++)
+    {
+        // benchmarked below
+        if (format == SATFormat_HDR)
+        {
+            continue;
+        }
+
+        gpuSAT->Resize(res.Width, res.Height, (SATFormat)format);
+
+        if (glGetError() == GL_OUT_OF_MEMORY)
+        {
+            fprintf(stderr, "%s: out of GPU memory for %s, skipped\n", res.Name, kSATFormatNames[format]);
+            continue;
+        }
+
+        for (int algorithm = 0; algorithm < SATAlgorithm_Count && compiled; algorithm++)
+        {
+            // the fallback is already benchmarked as itself
+            if (!gpuSAT->IsAlgorithmSupported((SATAlgorithm)algorithm))
+            {
+                if (format == 0)
+                {
+                    fprintf(stderr, "%s: %s not supported by this GPU, skipped\n", res.Name, kGPUAlgorithmNames[algorithm]);
+                }
+                continue;
+            }
+
+            for (int columnPass = 0; columnPass < SATColumnPass_Count && compiled; columnPass++)
+            {
+                BenchmarkResult result;
+                result.Implementation = kGPUAlgorithmNames[algorithm];
+                result.Res = &res;
+                result.Format = (SATFormat)format;
+                result.ColumnPass = columnPass;
+
+                fprintf(stderr, "%s: %s %s %s\n", res.Name, result.Implementation.c_str(), kSATFormatNames[format], kSATColumnPassNames[columnPass]);
+
+                compiled = TimeGPU(options, inputTO, (SATAlgorithm)algorithm, (SATColumnPass)columnPass, gpuSAT, queries, &result);
+                if (compiled)
+                {
+                    results->push_back(result);
+                }
+            }
+        }
+    }
+
+    // The HDR SAT isn't scanned, so it has no algorithms or column passes to compare. Its build is benchmarked on its own.
+    if (compiled)
+    {
+        gpuSAT->Resize(res.Width, res.Height, SATFormat_HDR);
+
+        if (glGetError() == GL_OUT_OF_MEMORY)
+        {
+            fprintf(stderr, "%s: out of GPU memory for %s, skipped\n", res.Name, kSATFormatNames[SATFormat_HDR]);
+        }
+        else
+        {
+            // the same image, converted to linear floats
+            GLuint hdrInputTO;
+            glGenTextures(1, &hdrInputTO);
+            glBindTexture(GL_TEXTURE_2D, hdrInputTO);
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA16F, res.Width, res.Height);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, res.Width, res.Height, GL_RGBA, GL_UNSIGNED_BYTE, image.data());
+            glBindTexture(GL_TEXTURE_2D, 0);
+
+            BenchmarkResult result;
+            result.Implementation = "gpu_hdr";
+            result.Res = &res;
+            result.Format = SATFormat_HDR;
+            result.ColumnPass = -1;
+
+            fprintf(stderr, "%s: %s %s\n", res.Name, result.Implementation.c_str(), kSATFormatNames[SATFormat_HDR]);
+
+            compiled = TimeGPU(options, hdrInputTO, SATAlgorithm_UpDownSweep, SATColumnPass_InPlace, gpuSAT, queries, &result);
+            if (compiled)
+            {
+                results->push_back(result);
+            }
+
+            glDeleteTextures(1, &hdrInputTO);
+        }
+    }
+
+    glDeleteQueries((GLsizei)queries.size(), queries.data());
+    glDeleteTextures(1, &inputTO);
+    return compiled;
+}
+
+static void WriteResultsJSON(
+    FILE* fp,
+    const BenchmarkOptions& options,
+    const char* glRenderer,
+    const std::vector<BenchmarkResult>& results)
+{
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"cpu_threads\": %u,\n", std::thread::hardware_concurrency());
+    fprintf(fp, "  \"cpu_best_isa\": \"%s\",\n", GetCPUSATKernelISAName(GetBestCPUSATKernelISA()));
+    fprintf(fp, "  \"gl_renderer\": \"%s\",\n", EscapeJSON(glRenderer).c_str());
+    fprintf(fp, "  \"iterations\": %d,\n", options.Iterations);
+    fprintf(fp, "  \"warmup_iterations\": %d,\n", options.WarmupIterations);
+    fprintf(fp, "  \"results\": [\n");
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const BenchmarkResult& result = results[i];
+
+        double medianMs = Percentile(result.Samples, 50.0);
+        double megapixels = (double)result.Res->Width * result.Res->Height / 1000000.0;
+        double gigabytes = GetSATBytes(result.Res->Width, result.Res->Height, result.Format) / 1000000000.0;
+
+        fprintf(fp, "    {\n");
+        fprintf(fp, "      \"implementation\": \"%s\",\n", result.Implementation.c_str());
+        fprintf(fp, "      \"resolution\": \"%s\",\n", result.Res->Name);
+        fprintf(fp, "      \"width\": %d,\n", result.Res->Width);
+        fprintf(fp, "      \"height\": %d,\n", result.Res->Height);
+        fprintf(fp, "      \"input_format\": \"%s\",\n", GetInputFormatName(result.Format));
+        fprintf(fp, "      \"sat_format\": \"%s\",\n", kSATFormatNames[result.Format]);
+        if (result.ColumnPass != -1)
+        {
+            fprintf(fp, "      \"column_pass\": \"%s\",\n", kSATColumnPassNames[result.ColumnPass]);
+        }
+        fprintf(fp, "      \"min_ms\": %.4f,\n", result.Samples.front());
+        fprintf(fp, "      \"median_ms\": %.4f,\n", medianMs);
+        fprintf(fp, "      \"p95_ms\": %.4f,\n", Percentile(result.Samples, 95.0));
+        fprintf(fp, "      \"max_ms\": %.4f,\n", result.Samples.back());
+        fprintf(fp, "      \"median_ns_per_pixel\": %.4f,\n", medianMs / megapixels);
+        fprintf(fp, "      \"median_megapixels_per_second\": %.2f,\n", megapixels / (medianMs / 1000.0));
+        fprintf(fp, "      \"median_gigabytes_per_second\": %.2f\n", gigabytes / (medianMs / 1000.0));
+        fprintf(fp, "    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+}
+
+extern "C"
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+    options.Iterations = 20;
+    options.WarmupIterations = 3;
+    options.SkipCPU = false;
+    options.SkipGPU = false;
+    options.SkipReference = false;
+
+    const char* outputFilename = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+        {
+            options.Iterations = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+        {
+            options.WarmupIterations = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+        {
+            outputFilename = argv[++i];
+        }
+        else if (strcmp(argv[i], "--skip-cpu") == 0)
+        {
+            options.SkipCPU = true;
+        }
+        else if (strcmp(argv[i], "--skip-gpu") == 0)
+        {
+            options.SkipGPU = true;
+        }
+        else if (strcmp(argv[i], "--skip-reference") == 0)
+        {
+            options.SkipReference = true;
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (options.Iterations < 1 || options.WarmupIterations < 0)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (!options.SkipGPU && !CreateHeadlessGLContext("satbench"))
+    {
+        return 1;
+    }
+
+    std::vector<BenchmarkResult> results;
+    std::string glRenderer;
+
+    // the shaders are deleted at the end of the scope, before the context is destroyed
+    {
+        ShaderSet shaders;
+        GPUSAT gpuSAT = {};
+
+        if (!options.SkipGPU)
+        {
+            glRenderer = (const char*)glGetString(GL_RENDERER);
+
+            shaders.SetVersion("440");
+            shaders.SetPreambleFile("preamble.glsl");
+            // not the tuned sizes, so the results of different GPUs are comparable
+            gpuSAT.Init(&shaders, GetDefaultSATWorkgroupSizes());
+            shaders.UpdatePrograms();
+        }
+
+        // Fixed seed, so every run benchmarks the same images.
+        std::mt19937 rng(1234);
+
+        for (const Resolution& res : kResolutions)
+        {
+            std::vector<glm::u8vec4> image(res.Width * res.Height);
+            for (glm::u8vec4& texel : image)
+            {
+                uint32_t bits = rng();
+                texel = glm::u8vec4(bits, bits >> 8, bits >> 16, bits >> 24);
+            }
+
+            if (!options.SkipCPU)
+            {
+                BenchmarkCPU(options, res, image, &results);
+            }
+
+            if (!options.SkipGPU)
+            {
+                if (!BenchmarkGPU(options, res, image, &gpuSAT, &results))
+                {
+                    return 1;
+                }
+            }
+        }
+
+        if (!options.SkipGPU)
+        {
+            gpuSAT.Release();
+        }
+    }
+
+    FILE* fp = stdout;
+    if (outputFilename)
+    {
+        fp = fopen(outputFilename, "w");
+        if (!fp)
+        {
+            perror(outputFilename);
+            return 1;
+        }
+    }
+
+    WriteResultsJSON(fp, options, glRenderer.c_str(), results);
+
+    if (fp != stdout)
+    {
+        fclose(fp);
+    }
+
+    if (!options.SkipGPU)
+    {
+        DestroyHeadlessGLContext();
+    }
+
+    return 0;
+}
\ No newline at end of file
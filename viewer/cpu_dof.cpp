@@ -0,0 +1,267 @@
+#include "cpu_dof.h"
+
+#include "cpu_sat.h"
+#include "parallel_for.h"
+#include "preamble.glsl"
+
+#include <algorithm>
+#include <cmath>
+
+// Number of rows blurred by a worker before it grabs more work.
+static const int kRowsPerJob = 16;
+
+// same names as dof.frag
+enum
+{
+    UR,
+    UL,
+    LR,
+    LL
+};
+
+glm::vec4 DepthOfFieldPixelCPU(
+    const glm::uvec4* sat, int width, int height,
+    int x, int y, float depth,
+    float zNear, float focus)
+{
+    glm::ivec2 sz = glm::ivec2(width, height);
+
+    // convert to eye space depth
+    depth = zNear / depth;
+
+    // radius of SAT blur
+    // Any radius that covers the whole image gives the same result after clamping,
+    // so it's clamped here to avoid undefined float to int conversions.
+    float radius = std::min(std::abs(depth - focus), (float)std::max(width, height));
+    int sw, sh;
+    sw = sh = (int)radius;
+
+    // each tap is offset from the box filter differently
+    glm::ivec2 tap_offsets[4];
+    tap_offsets[UR] = glm::ivec2(0, 0);
+    tap_offsets[UL] = glm::ivec2(1, 0);
+    tap_offsets[LR] = glm::ivec2(0, 1);
+    tap_offsets[LL] = glm::ivec2(1, 1);
+
+    // the 4 locations that will be sampled ("tapped")
+    glm::ivec2 fragCoord = glm::ivec2(x, y);
+    glm::ivec2 taps[4];
+    taps[UR] = fragCoord + glm::ivec2(+sw, +sh) - tap_offsets[UR];
+    taps[UL] = fragCoord + glm::ivec2(-sw, +sh) - tap_offsets[UL];
+    taps[LR] = fragCoord + glm::ivec2(+sw, -sh) - tap_offsets[LR];
+    taps[LL] = fragCoord + glm::ivec2(-sw, -sh) - tap_offsets[LL];
+
+    // sample the 4 corners of the SAT region
+    glm::uvec4 corners[4];
+    for (int i = 0; i < 4; i++)
+    {
+        // handle out-of-bounds by clamping
+        if (any(lessThan(taps[i], glm::ivec2(0)))) {
+            corners[i] = glm::uvec4(0);
+        }
+        else if (any(greaterThanEqual(taps[i], sz))) {
+            glm::ivec2 clamped = min(taps[i], sz - glm::ivec2(1));
+            corners[i] = sat[clamped.y * width + clamped.x];
+        }
+        else {
+            corners[i] = sat[taps[i].y * width + taps[i].x];
+        }
+    }
+
+    // the area of the blur might have changed from the clamping of the taps.
+    // the SAT is inclusive, so the sum covers (LL, UR], clamped the same way as the taps.
+    glm::ivec2 box_min = max(taps[LL] + glm::ivec2(1), glm::ivec2(0));
+    glm::ivec2 box_max = min(taps[UR], sz - glm::ivec2(1)) + glm::ivec2(1);
+    int boxsz = (box_max.x - box_min.x) * (box_max.y - box_min.y);
+
+    // perform a box filter
+    glm::vec4 sat_box = glm::vec4(corners[UR] - corners[UL] - corners[LR] + corners[LL]) / float(boxsz);
+
+    return glm::vec4(sat_box) / 255.0f;
+}
+
+// same as dof_kernel_taps() in preamble.glsl
+static int KernelTaps(int kernel, int radius, int offsets[6], int weights[6])
+{
+    if (kernel == DOF_KERNEL_TENT)
+    {
+        int w = radius + 1;
+        offsets[0] = -radius;         weights[0] = 1;
+        offsets[1] = -radius + w;     weights[1] = -2;
+        offsets[2] = -radius + 2 * w; weights[2] = 1;
+        return 3;
+    }
+
+    int a = (2 * radius + 3) / 3;
+    int b = 2 * radius + 3 - 2 * a;
+    offsets[0] = -radius;             weights[0] = -1;
+    offsets[1] = -radius + a;         weights[1] = 2;
+    offsets[2] = -radius + 2 * a;     weights[2] = -1;
+    offsets[3] = -radius + b;         weights[3] = 1;
+    offsets[4] = -radius + a + b;     weights[4] = -2;
+    offsets[5] = -radius + 2 * a + b; weights[5] = 1;
+    return 6;
+}
+
+// same as dof_kernel_weight() in preamble.glsl
+static int KernelWeight(int kernel, int radius)
+{
+    if (kernel == DOF_KERNEL_TENT)
+    {
+        return (radius + 1) * (radius + 1);
+    }
+
+    int a = (2 * radius + 3) / 3;
+    int b = 2 * radius + 3 - 2 * a;
+    return a * a * b;
+}
+
+// same as dof_kernel_weight_before() in preamble.glsl
+static int KernelWeightBefore(int kernel, int radius, int p)
+{
+    if (p >= radius)
+    {
+        return 0;
+    }
+
+    int offsets[6];
+    int weights[6];
+    int tapCount = KernelTaps(kernel, radius, offsets, weights);
+
+    int inside = 0;
+    for (int i = 0; i < tapCount; i++)
+    {
+        int x = std::max(p + offsets[i], 0);
+        int binomial = kernel == DOF_KERNEL_TENT ? x * (x - 1) / 2 : x * (x - 1) * (x - 2) / 6;
+        inside += weights[i] * binomial;
+    }
+    return KernelWeight(kernel, radius) - inside;
+}
+
+glm::vec4 DepthOfFieldKernelPixelCPU(
+    const glm::uvec4* sat, int satWidth, int width, int height,
+    int x, int y, float depth,
+    float zNear, float focus, int kernel)
+{
+    // convert to eye space depth
+    depth = zNear / depth;
+
+    // the radius is limited like dof_kernel_radius(), before the float to int conversion so that it can't overflow
+    int maxRadius = kernel == DOF_KERNEL_TENT ? DOF_TENT_MAX_BLUR_RADIUS : DOF_QUADRATIC_MAX_BLUR_RADIUS;
+    int radius = (int)std::min(std::abs(depth - focus), (float)maxRadius);
+
+    int offsets[6];
+    int weights[6];
+    int tapCount = KernelTaps(kernel, radius, offsets, weights);
+
+    // the taps and their weights wrap around modulo 2^32 like the iterated SAT
+    glm::uvec4 sum = glm::uvec4(0);
+    for (int j = 0; j < tapCount; j++)
+    {
+        for (int i = 0; i < tapCount; i++)
+        {
+            // nothing is summed before the image
+            glm::ivec2 tap = glm::ivec2(x + offsets[i], y + offsets[j]);
+            if (tap.x >= 0 && tap.y >= 0)
+            {
+                sum += (uint32_t)(weights[i] * weights[j]) * sat[tap.y * satWidth + tap.x];
+            }
+        }
+    }
+
+    // the weight of the kernel that's inside the image
+    int weight = KernelWeight(kernel, radius);
+    int weightX = weight - KernelWeightBefore(kernel, radius, x) - KernelWeightBefore(kernel, radius, width - 1 - x);
+    int weightY = weight - KernelWeightBefore(kernel, radius, y) - KernelWeightBefore(kernel, radius, height - 1 - y);
+
+    return glm::vec4(sum) / (float(weightX) * float(weightY)) / 255.0f;
+}
+
+static uint8_t EncodeSRGB8Channel(float linear)
+{
+    linear = std::min(std::max(linear, 0.0f), 1.0f);
+
+    float encoded;
+    if (linear <= 0.0031308f)
+    {
+        encoded = linear * 12.92f;
+    }
+    else
+    {
+        encoded = 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+    }
+
+    return (uint8_t)(encoded * 255.0f + 0.5f);
+}
+
+glm::u8vec4 EncodeSRGB8(glm::vec4 linear)
+{
+    float alpha = std::min(std::max(linear.a, 0.0f), 1.0f);
+
+    return glm::u8vec4(
+        EncodeSRGB8Channel(linear.r),
+        EncodeSRGB8Channel(linear.g),
+        EncodeSRGB8Channel(linear.b),
+        (uint8_t)(alpha * 255.0f + 0.5f));
+}
+
+// Writes the blur of each pixel returned by blurPixel(x, y, depth) to output, leaving the background as it is.
+template<class BlurPixel>
+static void BlurPixels(
+    const glm::u8vec4* color, const float* depth, int width, int height,
+    glm::u8vec4* output,
+    const BlurPixel& blurPixel)
+{
+    int rowJobCount = (height + kRowsPerJob - 1) / kRowsPerJob;
+    ParallelFor(rowJobCount, [&](int job)
+    {
+        int rowStart = job * kRowsPerJob;
+        int rowEnd = std::min(rowStart + kRowsPerJob, height);
+        for (int y = rowStart; y < rowEnd; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                int i = y * width + x;
+
+                if (depth[i] == 0.0f)
+                {
+                    // "infinitely far", so background.
+                    output[i] = color[i];
+                    continue;
+                }
+
+                output[i] = EncodeSRGB8(blurPixel(x, y, depth[i]));
+            }
+        }
+    });
+}
+
+void ApplyDepthOfFieldCPU(
+    const glm::u8vec4* color, const float* depth, int width, int height,
+    float zNear, float focus,
+    glm::uvec4* satScratch,
+    glm::u8vec4* output)
+{
+    ComputeSummedAreaTableCPU(color, width, height, satScratch, width);
+
+    BlurPixels(color, depth, width, height, output, [&](int x, int y, float pixelDepth)
+    {
+        return DepthOfFieldPixelCPU(satScratch, width, height, x, y, pixelDepth, zNear, focus);
+    });
+}
+
+void ApplyDepthOfFieldKernelCPU(
+    const glm::u8vec4* color, const float* depth, int width, int height,
+    float zNear, float focus, int kernel,
+    glm::uvec4* satScratch,
+    glm::u8vec4* output)
+{
+    int satWidth = width + SAT_ITERATED_PADDING;
+    int satHeight = height + SAT_ITERATED_PADDING;
+    ComputeIteratedSummedAreaTableCPUReference(color, width, height, DOF_KERNEL_ORDER(kernel), satScratch, satWidth, satHeight);
+
+    BlurPixels(color, depth, width, height, output, [&](int x, int y, float pixelDepth)
+    {
+        return DepthOfFieldKernelPixelCPU(satScratch, satWidth, width, height, x, y, pixelDepth, zNear, focus, kernel);
+    });
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+// Software implementation of the whole DoF post pass: builds the SAT on the CPU, then applies the logic of dof.frag.
+// Doesn't need a GPU, so it can be used for regression and performance testing on any machine.
+//
+// Images follow GL conventions: the first row is the bottom of the image.
+// color: the sRGB8 backbuffer, as read back with glReadPixels.
+// depth: the reversed-Z depth buffer (1 at the near plane, 0 infinitely far).
+// zNear, focus: the DOF_ZNEAR and DOF_FOCUS uniforms.
+// satScratch: width*height texels of scratch memory for the SAT.
+// output: the sRGB8 result, as it would be written to the backbuffer with GL_FRAMEBUFFER_SRGB enabled.
+//         Background pixels (depth == 0) are discarded by the shader, so they keep their input color.
+//
+// The output matches dof.frag run on the SAT computed by the CPU SAT path,
+// with a SAT texture that is exactly the size of the image.
+void ApplyDepthOfFieldCPU(
+    const glm::u8vec4* color, const float* depth, int width, int height,
+    float zNear, float focus,
+    glm::uvec4* satScratch,
+    glm::u8vec4* output);
+
+// Same as ApplyDepthOfFieldCPU, but blurs with a higher order kernel (DOF_KERNEL_TENT or DOF_KERNEL_QUADRATIC in preamble.glsl)
+// from the iterated SAT of its order, like dof.frag does with the GPU's.
+// satScratch: (width + SAT_ITERATED_PADDING) * (height + SAT_ITERATED_PADDING) texels of scratch memory for the iterated SAT.
+void ApplyDepthOfFieldKernelCPU(
+    const glm::u8vec4* color, const float* depth, int width, int height,
+    float zNear, float focus, int kernel,
+    glm::uvec4* satScratch,
+    glm::u8vec4* output);
+
+// Applies the dof.frag logic to one pixel, given a SAT of the image.
+// Returns the linear color written by the shader, before the framebuffer's sRGB encoding.
+glm::vec4 DepthOfFieldPixelCPU(
+    const glm::uvec4* sat, int width, int height,
+    int x, int y, float depth,
+    float zNear, float focus);
+
+// Applies the dof.frag logic of a higher order kernel to one pixel, given the iterated SAT of its order.
+// The iterated SAT is satWidth texels wide, padded past the image like the GPU's. (see ComputeIteratedSummedAreaTableCPUReference)
+glm::vec4 DepthOfFieldKernelPixelCPU(
+    const glm::uvec4* sat, int satWidth, int width, int height,
+    int x, int y, float depth,
+    float zNear, float focus, int kernel);
+
+// Encodes a linear color to sRGB8, like writing to an sRGB framebuffer. Alpha is not encoded.
+glm::u8vec4 EncodeSRGB8(glm::vec4 linear);
\ No newline at end of file
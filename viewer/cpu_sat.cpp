@@ -0,0 +1,535 @@
+#include "cpu_sat.h"
+
+#include "parallel_for.h"
+
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CPU_SAT_X86_KERNELS
+#endif
+
+#ifdef CPU_SAT_X86_KERNELS
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+// MSVC allows intrinsics for any instruction set in any function.
+#define CPU_SAT_TARGET_SSE41
+#define CPU_SAT_TARGET_AVX2
+#else
+// GCC and clang need to be told which functions may use the extra instructions.
+#define CPU_SAT_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define CPU_SAT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// Number of rows scanned by a worker before it grabs more work.
+static const int kRowsPerJob = 16;
+
+// Number of columns summed by a worker in the column pass.
+// 64 uvec4 texels are 1KB, so the previous row of a strip lives comfortably in L1.
+static const int kColumnStripWidth = 64;
+
+struct GammaLUT
+{
+    uint32_t Values[256];
+
+    GammaLUT()
+    {
+        // Uses exactly the same math as the reference, so the table gives bit-identical results.
+        for (int i = 0; i < 256; i++)
+        {
+            glm::uvec4 readback = glm::uvec4(i);
+            readback = glm::uvec4(pow(glm::vec4(readback) / 255.0f, glm::vec4(2.2f)) * 255.0f);
+            Values[i] = readback.x;
+        }
+    }
+};
+
+const uint32_t* GetCPUSATGammaLUT()
+{
+    static const GammaLUT lut;
+    return lut.Values;
+}
+
+static void ScanRow_Scalar(const glm::u8vec4* src, glm::uvec4* dst, int width, const uint32_t* lut)
+{
+    glm::uvec4 sum = glm::uvec4(0);
+    for (int col = 0; col < width; col++)
+    {
+        sum += glm::uvec4(lut[src[col].x], lut[src[col].y], lut[src[col].z], lut[src[col].w]);
+        dst[col] = sum;
+    }
+}
+
+static void AccumulateRow_Scalar(glm::uvec4* dst, const glm::uvec4* src, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        dst[i] += src[i];
+    }
+}
+
+#ifdef CPU_SAT_X86_KERNELS
+// One texel is exactly one 128-bit register, so the prefix sum is a running vector add.
+// SSE has no gather, so the table lookups are scalar.
+CPU_SAT_TARGET_SSE41
+static void ScanRow_SSE41(const glm::u8vec4* src, glm::uvec4* dst, int width, const uint32_t* lut)
+{
+    const uint8_t* bytes = (const uint8_t*)src;
+    __m128i sum = _mm_setzero_si128();
+    for (int col = 0; col < width; col++)
+    {
+        __m128i texel = _mm_cvtsi32_si128((int)lut[bytes[col * 4 + 0]]);
+        texel = _mm_insert_epi32(texel, (int)lut[bytes[col * 4 + 1]], 1);
+        texel = _mm_insert_epi32(texel, (int)lut[bytes[col * 4 + 2]], 2);
+        texel = _mm_insert_epi32(texel, (int)lut[bytes[col * 4 + 3]], 3);
+        sum = _mm_add_epi32(sum, texel);
+        _mm_storeu_si128((__m128i*)&dst[col], sum);
+    }
+}
+
+CPU_SAT_TARGET_SSE41
+static void AccumulateRow_SSE41(glm::uvec4* dst, const glm::uvec4* src, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)&dst[i]);
+        __m128i s = _mm_loadu_si128((const __m128i*)&src[i]);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_add_epi32(d, s));
+    }
+}
+
+// Processes 4 texels per iteration.
+// The bytes are widened to 32-bit indices and linearized with a gather from the lookup table,
+// which leaves 2 texels per register. The prefix sum of the pair is done in-register,
+// then the running sum of the previous texels is added on top.
+CPU_SAT_TARGET_AVX2
+static void ScanRow_AVX2(const glm::u8vec4* src, glm::uvec4* dst, int width, const uint32_t* lut)
+{
+    const uint8_t* bytes = (const uint8_t*)src;
+    __m256i sum = _mm256_setzero_si256();
+
+    int col = 0;
+    for (; col + 4 <= width; col += 4)
+    {
+        __m128i packed = _mm_loadu_si128((const __m128i*)&bytes[col * 4]);
+        __m256i lo = _mm256_i32gather_epi32((const int*)lut, _mm256_cvtepu8_epi32(packed), 4);
+        __m256i hi = _mm256_i32gather_epi32((const int*)lut, _mm256_cvtepu8_epi32(_mm_srli_si128(packed, 8)), 4);
+
+        // [a, b] -> [a, a + b]
+        lo = _mm256_add_epi32(lo, _mm256_permute2x128_si256(lo, lo, 0x08));
+        hi = _mm256_add_epi32(hi, _mm256_permute2x128_si256(hi, hi, 0x08));
+
+        // [c, d] -> [a + b + c, a + b + c + d]
+        __m256i loTotal = _mm256_permute2x128_si256(lo, lo, 0x11);
+        hi = _mm256_add_epi32(hi, loTotal);
+
+        lo = _mm256_add_epi32(lo, sum);
+        hi = _mm256_add_epi32(hi, sum);
+        _mm256_storeu_si256((__m256i*)&dst[col + 0], lo);
+        _mm256_storeu_si256((__m256i*)&dst[col + 2], hi);
+
+        sum = _mm256_permute2x128_si256(hi, hi, 0x11);
+    }
+
+    // leftover texels
+    __m128i sum128 = _mm256_castsi256_si128(sum);
+    for (; col < width; col++)
+    {
+        __m128i texel = _mm_setr_epi32(
+            (int)lut[bytes[col * 4 + 0]], (int)lut[bytes[col * 4 + 1]],
+            (int)lut[bytes[col * 4 + 2]], (int)lut[bytes[col * 4 + 3]]);
+        sum128 = _mm_add_epi32(sum128, texel);
+        _mm_storeu_si128((__m128i*)&dst[col], sum128);
+    }
+}
+
+CPU_SAT_TARGET_AVX2
+static void AccumulateRow_AVX2(glm::uvec4* dst, const glm::uvec4* src, int count)
+{
+    int i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        __m256i d = _mm256_loadu_si256((const __m256i*)&dst[i]);
+        __m256i s = _mm256_loadu_si256((const __m256i*)&src[i]);
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_add_epi32(d, s));
+    }
+
+    for (; i < count; i++)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)&dst[i]);
+        __m128i s = _mm_loadu_si128((const __m128i*)&src[i]);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_add_epi32(d, s));
+    }
+}
+#endif // CPU_SAT_X86_KERNELS
+
+static const CPUSATKernels kCPUSATKernels[CPUSATKernelISA_Count] = {
+    { ScanRow_Scalar, AccumulateRow_Scalar },
+#ifdef CPU_SAT_X86_KERNELS
+    { ScanRow_SSE41, AccumulateRow_SSE41 },
+    { ScanRow_AVX2, AccumulateRow_AVX2 },
+#else
+    { ScanRow_Scalar, AccumulateRow_Scalar },
+    { ScanRow_Scalar, AccumulateRow_Scalar },
+#endif
+};
+
+const char* GetCPUSATKernelISAName(CPUSATKernelISA isa)
+{
+    switch (isa)
+    {
+    case CPUSATKernelISA_Scalar: return "Scalar";
+    case CPUSATKernelISA_SSE41: return "SSE4.1";
+    case CPUSATKernelISA_AVX2: return "AVX2";
+    default: return "Unknown";
+    }
+}
+
+struct CPUFeatures
+{
+    bool SSE41;
+    bool AVX2;
+
+    CPUFeatures()
+    {
+        SSE41 = false;
+        AVX2 = false;
+
+#if defined(CPU_SAT_X86_KERNELS) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+
+        __cpuid(info, 1);
+        SSE41 = (info[2] & (1 << 19)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+
+        // AVX2 also needs the OS to save the YMM registers on context switches
+        if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6)
+        {
+            __cpuidex(info, 7, 0);
+            AVX2 = (info[1] & (1 << 5)) != 0;
+        }
+#elif defined(CPU_SAT_X86_KERNELS)
+        __builtin_cpu_init();
+        SSE41 = __builtin_cpu_supports("sse4.1") != 0;
+        AVX2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+    }
+};
+
+bool IsCPUSATKernelISASupported(CPUSATKernelISA isa)
+{
+    static const CPUFeatures features;
+
+    switch (isa)
+    {
+    case CPUSATKernelISA_Scalar: return true;
+    case CPUSATKernelISA_SSE41: return features.SSE41;
+    case CPUSATKernelISA_AVX2: return features.AVX2;
+    default: return false;
+    }
+}
+
+CPUSATKernelISA GetBestCPUSATKernelISA()
+{
+    for (int isa = CPUSATKernelISA_Count - 1; isa > CPUSATKernelISA_Scalar; isa--)
+    {
+        if (IsCPUSATKernelISASupported((CPUSATKernelISA)isa))
+        {
+            return (CPUSATKernelISA)isa;
+        }
+    }
+
+    return CPUSATKernelISA_Scalar;
+}
+
+const CPUSATKernels& GetCPUSATKernels(CPUSATKernelISA isa)
+{
+    if (!IsCPUSATKernelISASupported(isa))
+    {
+        isa = CPUSATKernelISA_Scalar;
+    }
+
+    return kCPUSATKernels[isa];
+}
+
+void ComputeSummedAreaTableCPU(
+    const glm::u8vec4* image, int width, int height,
+    glm::uvec4* sat, int satStride)
+{
+    static const CPUSATKernelISA bestISA = GetBestCPUSATKernelISA();
+    ComputeSummedAreaTableCPU(image, width, height, sat, satStride, bestISA);
+}
+
+void ComputeSummedAreaTableCPU(
+    const glm::u8vec4* image, int width, int height,
+    glm::uvec4* sat, int satStride,
+    CPUSATKernelISA isa)
+{
+    if (width <= 0 || height <= 0)
+    {
+        return;
+    }
+
+    const CPUSATKernels& kernels = GetCPUSATKernels(isa);
+    const uint32_t* lut = GetCPUSATGammaLUT();
+
+    // sum the rows. Every row is independent, so they're just split between the threads.
+    int rowJobCount = (height + kRowsPerJob - 1) / kRowsPerJob;
+    ParallelFor(rowJobCount, [&](int job)
+    {
+        int rowStart = job * kRowsPerJob;
+        int rowEnd = std::min(rowStart + kRowsPerJob, height);
+        for (int row = rowStart; row < rowEnd; row++)
+        {
+            kernels.ScanRow(&image[row * width], &sat[row * satStride], width, lut);
+        }
+    });
+
+    // sum the columns.
+    // Each job owns a vertical strip of the image and walks down it one row at a time,
+    // adding the row above, which was just written and is still in L1.
+    // This reads and writes every texel exactly once, in row-sized contiguous chunks,
+    // instead of striding down one column at a time like the reference does.
+    int stripCount = (width + kColumnStripWidth - 1) / kColumnStripWidth;
+    ParallelFor(stripCount, [&](int strip)
+    {
+        int colStart = strip * kColumnStripWidth;
+        int colEnd = std::min(colStart + kColumnStripWidth, width);
+        int stripWidth = colEnd - colStart;
+
+        for (int row = 1; row < height; row++)
+        {
+            kernels.AccumulateRow(
+                &sat[row * satStride + colStart],
+                &sat[(row - 1) * satStride + colStart],
+                stripWidth);
+        }
+    });
+}
+
+void ComputeCompactSummedAreaTableCPU(
+    const glm::u8vec4* image, int width, int height,
+    uint64_t* sat, int satStride)
+{
+    if (width <= 0 || height <= 0)
+    {
+        return;
+    }
+
+    const uint32_t* lut = GetCPUSATGammaLUT();
+
+    // Same passes as ComputeSummedAreaTableCPU, with a quarter of the adds since all 3 channels are summed at once.
+    // Plain 64-bit adds vectorize well enough that there's no need for hand-written kernels.
+    int rowJobCount = (height + kRowsPerJob - 1) / kRowsPerJob;
+    ParallelFor(rowJobCount, [&](int job)
+    {
+        int rowStart = job * kRowsPerJob;
+        int rowEnd = std::min(rowStart + kRowsPerJob, height);
+        for (int row = rowStart; row < rowEnd; row++)
+        {
+            const glm::u8vec4* src = &image[row * width];
+            uint64_t* dst = &sat[row * satStride];
+
+            uint64_t sum = 0;
+            for (int col = 0; col < width; col++)
+            {
+                sum += (uint64_t)lut[src[col].x] | ((uint64_t)lut[src[col].y] << 21) | ((uint64_t)lut[src[col].z] << 42);
+                dst[col] = sum;
+            }
+        }
+    });
+
+    int stripCount = (width + kColumnStripWidth - 1) / kColumnStripWidth;
+    ParallelFor(stripCount, [&](int strip)
+    {
+        int colStart = strip * kColumnStripWidth;
+        int colEnd = std::min(colStart + kColumnStripWidth, width);
+
+        for (int row = 1; row < height; row++)
+        {
+            uint64_t* dst = &sat[row * satStride];
+            const uint64_t* src = &sat[(row - 1) * satStride];
+            for (int col = colStart; col < colEnd; col++)
+            {
+                dst[col] += src[col];
+            }
+        }
+    });
+}
+
+void ComputeSummedAreaTableCPUReference(
+    const glm::u8vec4* image, int width, int height,
+    glm::uvec4* sat, int satStride)
+{
+    // sum the rows
+    for (int row = 0; row < height; row++)
+    {
+        glm::uvec4 first = glm::uvec4(image[row * width + 0]);
+        first = glm::uvec4(pow(glm::vec4(first) / 255.0f, glm::vec4(2.2f)) * 255.0f);
+        sat[row * satStride + 0] = first;
+
+        for (int col = 1; col < width; col++)
+        {
+            glm::uvec4 readback = glm::uvec4(image[row * width + col]);
+            readback = glm::uvec4(pow(glm::vec4(readback) / 255.0f, glm::vec4(2.2f)) * 255.0f);
+            sat[row * satStride + col] = readback + sat[row * satStride + (col - 1)];
+        }
+    }
+
+    // sum the columns (gross memory access...)
+    for (int col = 0; col < width; col++)
+    {
+        for (int row = 1; row < height; row++)
+        {
+            sat[row * satStride + col] += sat[(row - 1) * satStride + col];
+        }
+    }
+}
+
+void ComputeIteratedSummedAreaTableCPUReference(
+    const glm::u8vec4* image, int width, int height, int order,
+    glm::uvec4* sat, int satWidth, int satHeight)
+{
+    // the image, and nothing past it
+    for (int row = 0; row < satHeight; row++)
+    {
+        for (int col = 0; col < satWidth; col++)
+        {
+            glm::uvec4 readback = glm::uvec4(0);
+            if (row < height && col < width)
+            {
+                readback = glm::uvec4(image[row * width + col]);
+                readback = glm::uvec4(pow(glm::vec4(readback) / 255.0f, glm::vec4(2.2f)) * 255.0f);
+            }
+            sat[row * satWidth + col] = readback;
+        }
+    }
+
+    for (int i = 0; i < order; i++)
+    {
+        // sum the rows, excluding each texel from its own sum
+        for (int row = 0; row < satHeight; row++)
+        {
+            glm::uvec4 sum = glm::uvec4(0);
+            for (int col = 0; col < satWidth; col++)
+            {
+                glm::uvec4 texel = sat[row * satWidth + col];
+                sat[row * satWidth + col] = sum;
+                sum += texel;
+            }
+        }
+
+        // then the columns
+        for (int col = 0; col < satWidth; col++)
+        {
+            glm::uvec4 sum = glm::uvec4(0);
+            for (int row = 0; row < satHeight; row++)
+            {
+                glm::uvec4 texel = sat[row * satWidth + col];
+                sat[row * satWidth + col] = sum;
+                sum += texel;
+            }
+        }
+    }
+}
+
+CPUSATWorker::CPUSATWorker()
+{
+    mQuit = false;
+    mHasJob = false;
+    mThread = std::thread([this] { ThreadMain(); });
+}
+
+CPUSATWorker::~CPUSATWorker()
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return !mHasJob; });
+        mQuit = true;
+    }
+    mCondition.notify_all();
+    mThread.join();
+}
+
+void CPUSATWorker::Start(
+    const glm::u8vec4* image, int width, int height,
+    glm::uvec4* sat, int satStride,
+    bool useReference, CPUSATKernelISA isa)
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return !mHasJob; });
+
+        mImage = image;
+        mWidth = width;
+        mHeight = height;
+        mSAT = sat;
+        mCompactSAT = NULL;
+        mSATStride = satStride;
+        mUseReference = useReference;
+        mISA = isa;
+        mHasJob = true;
+    }
+    mCondition.notify_all();
+}
+
+void CPUSATWorker::Start(
+    const glm::u8vec4* image, int width, int height,
+    uint64_t* sat, int satStride)
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return !mHasJob; });
+
+        mImage = image;
+        mWidth = width;
+        mHeight = height;
+        mSAT = NULL;
+        mCompactSAT = sat;
+        mSATStride = satStride;
+        mHasJob = true;
+    }
+    mCondition.notify_all();
+}
+
+void CPUSATWorker::Wait()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this] { return !mHasJob; });
+}
+
+void CPUSATWorker::ThreadMain()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mCondition.wait(lock, [this] { return mHasJob || mQuit; });
+        if (mQuit)
+        {
+            break;
+        }
+
+        // compute outside the lock, the job's parameters can't change until mHasJob is cleared.
+        lock.unlock();
+        if (mCompactSAT)
+        {
+            ComputeCompactSummedAreaTableCPU(mImage, mWidth, mHeight, mCompactSAT, mSATStride);
+        }
+        else if (mUseReference)
+        {
+            ComputeSummedAreaTableCPUReference(mImage, mWidth, mHeight, mSAT, mSATStride);
+        }
+        else
+        {
+            ComputeSummedAreaTableCPU(mImage, mWidth, mHeight, mSAT, mSATStride, mISA);
+        }
+        lock.lock();
+
+        mHasJob = false;
+        mCondition.notify_all();
+    }
+}
\ No newline at end of file
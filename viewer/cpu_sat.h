@@ -0,0 +1,125 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// CPU implementations of the summed area table (SAT) used by the DoF blur.
+// The input is an 8-bit sRGB image of width*height tightly packed texels (as read back with glReadPixels).
+// Each texel is converted to linear (gamma 2.2) and scaled back to [0,255] before being summed.
+// The output SAT is inclusive (texel (x,y) holds the sum of [0,x]x[0,y]), and rows are satStride texels apart.
+
+// Instruction sets that the SAT kernels are implemented with.
+enum CPUSATKernelISA
+{
+    CPUSATKernelISA_Scalar,
+    CPUSATKernelISA_SSE41,
+    CPUSATKernelISA_AVX2,
+    CPUSATKernelISA_Count
+};
+
+// The inner loops of the CPU SAT. Exposed individually so they can be benchmarked on their own.
+// All implementations produce bit-identical results.
+struct CPUSATKernels
+{
+    // Converts a row of width sRGB texels to linear using the 256-entry lut, and writes its inclusive prefix sum to dst.
+    void(*ScanRow)(const glm::u8vec4* src, glm::uvec4* dst, int width, const uint32_t* lut);
+
+    // Adds src[i] to dst[i] for count texels. The column pass uses this to add each row to the row above it.
+    void(*AccumulateRow)(glm::uvec4* dst, const glm::uvec4* src, int count);
+};
+
+const char* GetCPUSATKernelISAName(CPUSATKernelISA isa);
+
+// Checks the running CPU (and OS) for support of the instruction set.
+bool IsCPUSATKernelISASupported(CPUSATKernelISA isa);
+
+// The fastest instruction set supported by the running CPU.
+CPUSATKernelISA GetBestCPUSATKernelISA();
+
+// Kernels for the given instruction set. The scalar kernels are returned if the instruction set is not supported.
+const CPUSATKernels& GetCPUSATKernels(CPUSATKernelISA isa);
+
+// 256-entry lookup table that converts an 8-bit sRGB channel to linear [0,255] the same way as the reference.
+const uint32_t* GetCPUSATGammaLUT();
+
+// Computes the SAT using all the cores of the machine.
+// Rows are scanned in parallel, then the columns are summed in parallel vertical strips.
+// The kernels default to the best instruction set supported by the CPU.
+void ComputeSummedAreaTableCPU(
+    const glm::u8vec4* image, int width, int height,
+    glm::uvec4* sat, int satStride);
+
+void ComputeSummedAreaTableCPU(
+    const glm::u8vec4* image, int width, int height,
+    glm::uvec4* sat, int satStride,
+    CPUSATKernelISA isa);
+
+// Single-threaded version of the SAT, written as plainly as possible.
+// This is the golden reference that the other implementations are compared against.
+void ComputeSummedAreaTableCPUReference(
+    const glm::u8vec4* image, int width, int height,
+    glm::uvec4* sat, int satStride);
+
+// Computes the iterated SAT of the given order, like GPUSAT does, for the higher order DoF kernels (DOF_KERNEL_ORDER in preamble.glsl).
+// Unlike the other SATs, it's exclusive like the GPU SAT (texel (x,y) holds the sum of [0,x)x[0,y)),
+// and each order sums the one below it again, modulo 2^32.
+// sat is satWidth*satHeight texels: the image followed by 0s, so it can be padded like the GPU's. (see SAT_ITERATED_PADDING)
+void ComputeIteratedSummedAreaTableCPUReference(
+    const glm::u8vec4* image, int width, int height, int order,
+    glm::uvec4* sat, int satWidth, int satHeight);
+
+// Computes the SAT in the compact format (SAT_FORMAT_COMPACT in preamble.glsl):
+// R, G and B are packed into one 64-bit integer (R | G << 21 | B << 42), and summed modulo 2^64.
+// Box sums of up to (2 * SAT_COMPACT_MAX_BLUR_RADIUS + 1)^2 texels can be unpacked exactly. Alpha isn't stored.
+// Rows are scanned in parallel, then the columns are summed in parallel vertical strips.
+void ComputeCompactSummedAreaTableCPU(
+    const glm::u8vec4* image, int width, int height,
+    uint64_t* sat, int satStride);
+
+// Computes SATs on a background thread, so the calling thread can keep working while the SAT is built.
+// Only one SAT is computed at a time.
+class CPUSATWorker
+{
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+
+    bool mQuit;
+    bool mHasJob;
+
+    const glm::u8vec4* mImage;
+    int mWidth;
+    int mHeight;
+    glm::uvec4* mSAT;
+    uint64_t* mCompactSAT;
+    int mSATStride;
+    bool mUseReference;
+    CPUSATKernelISA mISA;
+
+    void ThreadMain();
+
+public:
+    CPUSATWorker();
+
+    // Waits for the current SAT to complete, then stops the thread.
+    ~CPUSATWorker();
+
+    // Starts computing a SAT with the same parameters as ComputeSummedAreaTableCPU.
+    // Waits for the previous SAT to complete first. image and sat must stay valid until Wait() returns.
+    void Start(
+        const glm::u8vec4* image, int width, int height,
+        glm::uvec4* sat, int satStride,
+        bool useReference, CPUSATKernelISA isa);
+
+    // Starts computing a SAT with the same parameters as ComputeCompactSummedAreaTableCPU.
+    void Start(
+        const glm::u8vec4* image, int width, int height,
+        uint64_t* sat, int satStride);
+
+    // Blocks until the SAT started by the last call to Start() is complete.
+    void Wait();
+};
\ No newline at end of file
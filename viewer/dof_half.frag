@@ -0,0 +1,50 @@
+layout(binding = DOF_HALF_SAT_TEXTURE_BINDING) uniform usampler2D HalfSAT;
+layout(binding = DOF_QUARTER_SAT_TEXTURE_BINDING) uniform usampler2D QuarterSAT;
+layout(binding = DOF_DEPTH_TEXTURE_BINDING) uniform sampler2D Depth;
+
+layout(location = DOF_ZNEAR_UNIFORM_LOCATION) uniform float ZNear;
+layout(location = DOF_FOCUS_UNIFORM_LOCATION) uniform float Focus;
+layout(location = DOF_SAT_LEVELS_UNIFORM_LOCATION) uniform int SATLevels;
+layout(location = DOF_SAT_INCLUSIVE_UNIFORM_LOCATION) uniform int SATInclusive;
+
+// linear, unlike the backbuffer
+layout(location = DOF_HALF_COLOR_OUTPUT_LOCATION) out vec4 FragColor;
+// the ndc depth the block was blurred for, 0 if it's all background
+layout(location = DOF_HALF_DEPTH_OUTPUT_LOCATION) out float FragDepth;
+
+// Blurs a 2x2 block of the image, drawn over the half resolution buffers.
+void main()
+{
+    ivec2 block = ivec2(gl_FragCoord.xy) << 1;
+    ivec2 image_size = textureSize(Depth, 0);
+
+    // the block is blurred for its nearest pixel that isn't background.
+    // the last row and column of an odd-sized image have partial blocks.
+    float depth = 0.0;
+    for (int i = 0; i < 4; i++)
+    {
+        ivec2 p = min(block + ivec2(i & 1, i >> 1), image_size - ivec2(1));
+        depth = max(depth, texelFetch(Depth, p, 0).x);
+    }
+
+    FragDepth = depth;
+
+    if (depth == 0.0)
+    {
+        // "infinitely far", so background.
+        FragColor = vec4(0.0);
+        return;
+    }
+
+    int radius = dof_blur_radius(depth, ZNear, Focus);
+
+    // the full resolution level isn't built for the half resolution DoF
+    int level = dof_sat_level(SATLevels, radius);
+
+    if (level == 2) {
+        FragColor = dof_sat_box_filter(QuarterSAT, 2, block, radius, SATInclusive, image_size);
+    }
+    else {
+        FragColor = dof_sat_box_filter(HalfSAT, 1, block, radius, SATInclusive, image_size);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,10 @@
+layout(binding = DOF_SEPARABLE_OUTPUT_TEXTURE_BINDING) uniform sampler2D SeparableOutput;
+
+out vec4 FragColor;
+
+// Copies the separable tiles blurred by dof_separable.comp over the backbuffer. (see DoFTiles::Draw)
+// The tiles are already encoded to sRGB, so this is drawn without GL_FRAMEBUFFER_SRGB.
+void main()
+{
+    FragColor = texelFetch(SeparableOutput, ivec2(gl_FragCoord.xy), 0);
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+// This shader renders a quad over each tile of a list classified by dof_tiles.comp, one instance per tile.
+// Call it with the indirect draw of the tiles' class. (see DoFTiles::Draw)
+
+layout(binding = DOF_DEPTH_TEXTURE_BINDING) uniform sampler2D Depth;
+layout(binding = DOF_TILE_LISTS_TEXTURE_BINDING) uniform usamplerBuffer Tiles;
+
+layout(location = DOF_TILE_LIST_OFFSET_UNIFORM_LOCATION) uniform int TileListOffset;
+
+layout(location = DOF_TILE_RADIUS_VARYING_LOCATION) flat out int oTileRadius;
+
+void main()
+{
+    uvec2 tile = texelFetch(Tiles, TileListOffset + gl_InstanceID).xy;
+    ivec2 tile_xy = ivec2(tile.x & 0xFFFFu, tile.x >> 16);
+
+    // (0,0) (1,0) (0,1), (0,1) (1,0) (1,1)
+    ivec2 corner = ivec2((0x32 >> gl_VertexID) & 1, (0x2C >> gl_VertexID) & 1);
+
+    // the quads of the tiles at the edges go past the image, and are clipped by the viewport
+    vec2 pixel = vec2((tile_xy + corner) * DOF_TILE_SIZE);
+
+    vec4 pos;
+    pos.xy = pixel / vec2(textureSize(Depth, 0)) * 2.0 - 1.0;
+    pos.z = 0.0;
+    pos.w = 1.0;
+
+    gl_Position = pos;
+    oTileRadius = int(tile.y);
+}
\ No newline at end of file
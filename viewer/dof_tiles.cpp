@@ -0,0 +1,140 @@
+#include "dof_tiles.h"
+
+#include "shaderset.h"
+
+#include "preamble.glsl"
+
+#include <cstddef>
+
+// same layout as TileCommandsBuffer in dof_tiles.comp
+struct DoFTileCommands
+{
+    GLDrawArraysIndirectCommand Draws[DOF_TILE_CLASS_COUNT];
+    GLuint Dispatches[DOF_TILE_CLASS_COUNT][3];
+};
+
+void DoFTiles::Init(ShaderSet* shaders)
+{
+    mClassifySP = shaders->AddProgramFromExts({ "dof_tiles.comp" });
+}
+
+void DoFTiles::Resize(int width, int height)
+{
+    mWidth = width;
+    mHeight = height;
+    mTileCountX = (mWidth + DOF_TILE_SIZE - 1) / DOF_TILE_SIZE;
+    mTileCountY = (mHeight + DOF_TILE_SIZE - 1) / DOF_TILE_SIZE;
+
+    // reset before every classification
+    glDeleteBuffers(1, &mCommandsBO);
+    glGenBuffers(1, &mCommandsBO);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandsBO);
+    glBufferStorage(GL_DRAW_INDIRECT_BUFFER, sizeof(DoFTileCommands), NULL, GL_DYNAMIC_STORAGE_BIT);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    // x | y << 16 and the radius of each tile
+    glDeleteBuffers(1, &mTileListsBO);
+    glGenBuffers(1, &mTileListsBO);
+    glBindBuffer(GL_TEXTURE_BUFFER, mTileListsBO);
+    glBufferStorage(GL_TEXTURE_BUFFER, DOF_TILE_CLASS_COUNT * GetTileCount() * sizeof(GLuint) * 2, NULL, 0);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    glDeleteTextures(1, &mTileListsTO);
+    glGenTextures(1, &mTileListsTO);
+    glBindTexture(GL_TEXTURE_BUFFER, mTileListsTO);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RG32UI, mTileListsBO);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
+
+bool DoFTiles::Classify(GLuint depthTO, float zNear, float focus, int separableMaxRadius)
+{
+    if (!*mClassifySP)
+    {
+        return false;
+    }
+
+    // every class starts with no tiles
+    DoFTileCommands commands;
+    for (int tileClass = 0; tileClass < DOF_TILE_CLASS_COUNT; tileClass++)
+    {
+        GLDrawArraysIndirectCommand& draw = commands.Draws[tileClass];
+        draw.count = DOF_TILE_VERTEX_COUNT;
+        draw.primCount = 0;
+        draw.first = 0;
+        draw.baseInstance = 0;
+
+        GLuint* dispatch = commands.Dispatches[tileClass];
+        dispatch[0] = 0;
+        dispatch[1] = 1;
+        dispatch[2] = 1;
+    }
+
+    // the atomic adds of the previous classification must land before the reset
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandsBO);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, sizeof(commands), &commands);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    glUseProgram(*mClassifySP);
+    glUniform1f(DOF_ZNEAR_UNIFORM_LOCATION, zNear);
+    glUniform1f(DOF_FOCUS_UNIFORM_LOCATION, focus);
+    glUniform1i(DOF_TILE_SEPARABLE_MAX_RADIUS_UNIFORM_LOCATION, separableMaxRadius);
+
+    glBindTextures(DOF_DEPTH_TEXTURE_BINDING, 1, &depthTO);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DOF_TILE_COMMANDS_BUFFER_BINDING, mCommandsBO);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DOF_TILE_LISTS_BUFFER_BINDING, mTileListsBO);
+
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+    // a workgroup per tile
+    glDispatchCompute(mTileCountX, mTileCountY, 1);
+
+    glBindTextures(DOF_DEPTH_TEXTURE_BINDING, 1, NULL);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DOF_TILE_COMMANDS_BUFFER_BINDING, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DOF_TILE_LISTS_BUFFER_BINDING, 0);
+    glUseProgram(0);
+
+    // the lists are read through a buffer texture, and the commands by the indirect draws and dispatches
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+
+    return true;
+}
+
+void DoFTiles::Draw(int tileClass)
+{
+    glBindTextures(DOF_TILE_LISTS_TEXTURE_BINDING, 1, &mTileListsTO);
+    glUniform1i(DOF_TILE_LIST_OFFSET_UNIFORM_LOCATION, tileClass * GetTileCount());
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandsBO);
+    glDrawArraysIndirect(GL_TRIANGLES, (GLvoid*)(tileClass * sizeof(GLDrawArraysIndirectCommand)));
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    glBindTextures(DOF_TILE_LISTS_TEXTURE_BINDING, 1, NULL);
+}
+
+void DoFTiles::Dispatch(int tileClass)
+{
+    glBindTextures(DOF_TILE_LISTS_TEXTURE_BINDING, 1, &mTileListsTO);
+    glUniform1i(DOF_TILE_LIST_OFFSET_UNIFORM_LOCATION, tileClass * GetTileCount());
+
+    glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, mCommandsBO);
+    glDispatchComputeIndirect(offsetof(DoFTileCommands, Dispatches) + tileClass * sizeof(GLuint) * 3);
+    glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
+
+    glBindTextures(DOF_TILE_LISTS_TEXTURE_BINDING, 1, NULL);
+}
+
+void DoFTiles::Release()
+{
+    glDeleteBuffers(1, &mCommandsBO);
+    mCommandsBO = 0;
+    glDeleteBuffers(1, &mTileListsBO);
+    mTileListsBO = 0;
+    glDeleteTextures(1, &mTileListsTO);
+    mTileListsTO = 0;
+}
+
+int DoFTiles::GetTileCount() const
+{
+    return mTileCountX * mTileCountY;
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "opengl.h"
+
+class ShaderSet;
+
+// Classifies the tiles of the image by the blur radii of their pixels, so the DoF can skip or simplify most of them.
+// Each DOF_TILE_SIZE x DOF_TILE_SIZE tile is either in focus, uniformly blurred or mixed (see DOF_TILE_CLASS_*).
+// The classification writes a list of tiles per class, along with an indirect draw of a quad per tile
+// and an indirect dispatch of a workgroup per tile (dof_tiles.comp),
+// so the tiles of a class are drawn or computed without reading the classification back. (dof_tile.vert)
+class DoFTiles
+{
+    GLuint* mClassifySP;
+
+    int mWidth;
+    int mHeight;
+    int mTileCountX;
+    int mTileCountY;
+
+    // A DrawArraysIndirectCommand per class, followed by a dispatch per class. (see TileCommandsBuffer in dof_tiles.comp)
+    GLuint mCommandsBO;
+    // The tiles of every class, each list sized for all the tiles. Also viewed as a buffer texture, for the vertex shader.
+    GLuint mTileListsBO;
+    GLuint mTileListsTO;
+
+public:
+    // Adds the classification program to the shader set. It's compiled by the next ShaderSet::UpdatePrograms().
+    void Init(ShaderSet* shaders);
+
+    // (Re)allocates the buffers for an image of the given size.
+    void Resize(int width, int height);
+
+    // Dispatches the classification of the tiles of depthTO (the reversed-Z depth buffer), with the DoF's parameters.
+    // The uniform tiles with a radius of at most separableMaxRadius are classified as DOF_TILE_CLASS_SEPARABLE instead.
+    // Returns false (and dispatches nothing) if the program failed to compile.
+    bool Classify(GLuint depthTO, float zNear, float focus, int separableMaxRadius = 0);
+
+    // Draws a quad over each tile of the class from the last Classify(), with the program that's currently bound.
+    // The program's vertex shader should be dof_tile.vert, and its depth texture should be bound.
+    void Draw(int tileClass);
+
+    // Dispatches a workgroup per tile of the class from the last Classify(), with the compute program that's currently bound.
+    // Workgroup i computes the tile at DOF_TILE_LIST_OFFSET_UNIFORM_LOCATION + i of the DOF_TILE_LISTS_TEXTURE_BINDING buffer texture.
+    void Dispatch(int tileClass);
+
+    // Deletes the buffers. The program belongs to the shader set, so it's left alone.
+    void Release();
+
+    int GetTileCount() const;
+};
\ No newline at end of file
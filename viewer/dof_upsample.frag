@@ -0,0 +1,62 @@
+layout(binding = DOF_HALF_COLOR_TEXTURE_BINDING) uniform sampler2D HalfColor;
+layout(binding = DOF_HALF_DEPTH_TEXTURE_BINDING) uniform sampler2D HalfDepth;
+layout(binding = DOF_DEPTH_TEXTURE_BINDING) uniform sampler2D Depth;
+
+layout(location = DOF_ZNEAR_UNIFORM_LOCATION) uniform float ZNear;
+layout(location = DOF_FOCUS_UNIFORM_LOCATION) uniform float Focus;
+
+out vec4 FragColor;
+
+// Blends the half resolution DoF of the blocks around each pixel that's out of focus into the backbuffer.
+// The blocks are weighted bilinearly, and by how close their depth is to the pixel's, so the blur of the
+// foreground doesn't bleed over the background at full resolution edges and vice versa.
+void main()
+{
+    ivec2 p = ivec2(gl_FragCoord.xy);
+
+    // sample ndc depth
+    float depth = texelFetch(Depth, p, 0).x;
+
+    if (depth == 0.0)
+    {
+        // "infinitely far", so background.
+        discard;
+    }
+
+    if (dof_blur_radius(depth, ZNear, Focus) == 0)
+    {
+        // in focus, so kept at full resolution.
+        discard;
+    }
+
+    // convert to eye space depth
+    depth = ZNear / depth;
+
+    // the 4 blocks whose centers surround the pixel. the pixel's own block is always one of them.
+    ivec2 half_size = textureSize(HalfColor, 0);
+    vec2 half_coord = (vec2(p) + 0.5) * 0.5 - 0.5;
+    ivec2 base = ivec2(floor(half_coord));
+    vec2 f = half_coord - vec2(base);
+
+    vec4 color_sum = vec4(0.0);
+    float weight_sum = 0.0;
+    for (int i = 0; i < 4; i++)
+    {
+        ivec2 offset = ivec2(i & 1, i >> 1);
+        ivec2 block = clamp(base + offset, ivec2(0), half_size - ivec2(1));
+
+        float block_depth = texelFetch(HalfDepth, block, 0).x;
+        if (block_depth == 0.0) {
+            // all background, so it wasn't blurred.
+            continue;
+        }
+
+        vec2 bilinear = mix(1.0 - f, f, vec2(offset));
+        float weight = bilinear.x * bilinear.y / (DOF_UPSAMPLE_DEPTH_EPSILON + abs(depth - ZNear / block_depth));
+
+        color_sum += texelFetch(HalfColor, block, 0) * weight;
+        weight_sum += weight;
+    }
+
+    FragColor = color_sum / weight_sum;
+}
\ No newline at end of file
@@ -0,0 +1,689 @@
+#include "gpu_sat.h"
+
+#include "shaderset.h"
+
+#include "preamble.glsl"
+
+#include <algorithm>
+#include <cstring>
+
+const char* GetSATFormatName(SATFormat format)
+{
+    switch (format)
+    {
+    case SATFormat_RGBA32UI: return "RGBA32UI";
+    case SATFormat_Compact: return "Compact (RG32UI)";
+    case SATFormat_HDR: return "HDR (Tiled Float, RGBA32UI)";
+    default: return "Unknown";
+    }
+}
+
+const char* GetSATAlgorithmName(SATAlgorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case SATAlgorithm_UpDownSweep: return "Up/Down-Sweep";
+    case SATAlgorithm_LookBack: return "Decoupled Look-Back";
+    case SATAlgorithm_Subgroup: return "Up/Down-Sweep (Subgroups)";
+    case SATAlgorithm_UpDownSweepPadded: return "Up/Down-Sweep (Padded In-Place)";
+    default: return "Unknown";
+    }
+}
+
+const char* GetSATColumnPassName(SATColumnPass columnPass)
+{
+    switch (columnPass)
+    {
+    case SATColumnPass_InPlace: return "In-Place";
+    case SATColumnPass_Transpose: return "Transpose";
+    case SATColumnPass_TiledTranspose: return "Tiled Transpose";
+    default: return "Unknown";
+    }
+}
+
+const char* GetSATPyramidName(SATPyramid pyramid)
+{
+    switch (pyramid)
+    {
+    case SATPyramid_Full: return "Full";
+    case SATPyramid_FullHalfQuarter: return "Full, Half, Quarter";
+    case SATPyramid_HalfQuarter: return "Half, Quarter";
+    case SATPyramid_Quarter: return "Quarter";
+    default: return "Unknown";
+    }
+}
+
+int GetSATPyramidLevels(SATPyramid pyramid)
+{
+    switch (pyramid)
+    {
+    case SATPyramid_Full: return 1 << 0;
+    case SATPyramid_FullHalfQuarter: return (1 << 0) | (1 << 1) | (1 << 2);
+    case SATPyramid_HalfQuarter: return (1 << 1) | (1 << 2);
+    case SATPyramid_Quarter: return 1 << 2;
+    default: return 1 << 0;
+    }
+}
+
+GLenum GetSATInternalFormat(SATFormat format)
+{
+    switch (format)
+    {
+    case SATFormat_RGBA32UI: return GL_RGBA32UI;
+    case SATFormat_Compact: return GL_RG32UI;
+    case SATFormat_HDR: return GL_RGBA32UI;
+    default: return GL_NONE;
+    }
+}
+
+std::string GetSATFormatDefines(SATFormat format)
+{
+    int satFormat;
+    switch (format)
+    {
+    case SATFormat_Compact: satFormat = SAT_FORMAT_COMPACT; break;
+    case SATFormat_HDR: satFormat = SAT_FORMAT_HDR; break;
+    default: satFormat = SAT_FORMAT_RGBA32UI; break;
+    }
+    return "#define SAT_FORMAT " + std::to_string(satFormat) + "\n";
+}
+
+SATWorkgroupSizes GetDefaultSATWorkgroupSizes()
+{
+    SATWorkgroupSizes sizes;
+    sizes.Scan = SAT_WORKGROUP_SIZE_X;
+    sizes.Transpose = TRANSPOSE_SAT_WORKGROUP_SIZE_X;
+    return sizes;
+}
+
+std::string GetSATWorkgroupSizesDefines(const SATWorkgroupSizes& sizes)
+{
+    return "#define SAT_WORKGROUP_SIZE_X " + std::to_string(sizes.Scan) + "\n" +
+        "#define TRANSPOSE_SAT_WORKGROUP_SIZE_X " + std::to_string(sizes.Transpose) + "\n";
+}
+
+#ifndef GL_SUBGROUP_SIZE_KHR
+#define GL_SUBGROUP_SIZE_KHR                    0x9532
+#define GL_SUBGROUP_SUPPORTED_STAGES_KHR        0x9533
+#define GL_SUBGROUP_SUPPORTED_FEATURES_KHR      0x9534
+#define GL_SUBGROUP_FEATURE_BASIC_BIT_KHR       0x00000001
+#define GL_SUBGROUP_FEATURE_ARITHMETIC_BIT_KHR  0x00000004
+#endif
+
+// Whether compute shaders can use GL_KHR_shader_subgroup_arithmetic.
+static bool IsSubgroupArithmeticSupported()
+{
+    bool hasExtension = false;
+    GLint numExtensions;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+    for (GLint i = 0; i < numExtensions; i++)
+    {
+        if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), "GL_KHR_shader_subgroup") == 0)
+        {
+            hasExtension = true;
+            break;
+        }
+    }
+
+    if (!hasExtension)
+    {
+        return false;
+    }
+
+    GLint stages, features;
+    glGetIntegerv(GL_SUBGROUP_SUPPORTED_STAGES_KHR, &stages);
+    glGetIntegerv(GL_SUBGROUP_SUPPORTED_FEATURES_KHR, &features);
+
+    GLint requiredFeatures = GL_SUBGROUP_FEATURE_BASIC_BIT_KHR | GL_SUBGROUP_FEATURE_ARITHMETIC_BIT_KHR;
+    return (stages & GL_COMPUTE_SHADER_BIT) && (features & requiredFeatures) == requiredFeatures;
+}
+
+void GPUSAT::Init(ShaderSet* shaders, const SATWorkgroupSizes& workgroupSizes)
+{
+    mWorkgroupSizes = workgroupSizes;
+    mSubgroupsSupported = IsSubgroupArithmeticSupported();
+
+    for (int format = 0; format < SATFormat_Count; format++)
+    {
+        // the HDR SAT isn't scanned, it has its own programs
+        if (format == SATFormat_HDR)
+        {
+            continue;
+        }
+
+        std::string defines = GetSATFormatDefines((SATFormat)format) + GetSATWorkgroupSizesDefines(mWorkgroupSizes);
+        mUpsweepSP[format] = shaders->AddProgramFromExts({ "sat_up.comp" }, defines);
+        mDownsweepSP[format] = shaders->AddProgramFromExts({ "sat_down.comp" }, defines);
+        mTransposeSP[format] = shaders->AddProgramFromExts({ "sat_transpose.comp" }, defines);
+        mTiledTransposeSP[format] = shaders->AddProgramFromExts({ "sat_transpose_tiled.comp" }, defines);
+        mScanSP[format] = shaders->AddProgramFromExts({ "sat_scan.comp" }, defines);
+        mPaddedUpsweepSP[format] = shaders->AddProgramFromExts({ "sat_up_padded.comp" }, defines);
+        mPaddedDownsweepSP[format] = shaders->AddProgramFromExts({ "sat_down_padded.comp" }, defines);
+        mDownsampleSP[format] = shaders->AddProgramFromExts({ "sat_downsample.comp" }, defines);
+
+        // compiling them without the extension would only fill the log with errors
+        if (mSubgroupsSupported)
+        {
+            std::string subgroupDefines = defines +
+                "#extension GL_KHR_shader_subgroup_basic : require\n"
+                "#extension GL_KHR_shader_subgroup_arithmetic : require\n"
+                "#define SAT_SUBGROUPS\n";
+            mSubgroupUpsweepSP[format] = shaders->AddProgramFromExts({ "sat_up_subgroup.comp" }, subgroupDefines);
+            mSubgroupDownsweepSP[format] = shaders->AddProgramFromExts({ "sat_down_subgroup.comp" }, subgroupDefines);
+        }
+    }
+
+    std::string hdrDefines = GetSATFormatDefines(SATFormat_HDR);
+    mHDRTilesSP = shaders->AddProgramFromExts({ "sat_hdr_tiles.comp" }, hdrDefines);
+    mHDROffsetsSP = shaders->AddProgramFromExts({ "sat_hdr_offsets.comp" }, hdrDefines);
+
+    glGenQueries(4, &mTransposeTimestampQueries[0]);
+}
+
+// The number of workgroups of the given size that scan a row of the given length.
+static int GetNumSATWorkgroups(int length, int workgroupSize)
+{
+    return (length + workgroupSize - 1) / workgroupSize;
+}
+
+static GLuint CreateSATTexture(GLenum internalFormat, int width, int height)
+{
+    GLuint to;
+    glGenTextures(1, &to);
+    glBindTexture(GL_TEXTURE_2D, to);
+    glTexStorage2D(GL_TEXTURE_2D, 1, internalFormat, width, height);
+    // Integer textures are incomplete with the default (linear) filters, and texelFetch of an incomplete texture returns 0.
+    // Some drivers let it slide, but not all of them.
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return to;
+}
+
+// Creates the workgroup sums of each level of the scan of numRows rows of the given length.
+// Levels are added until the last one fits in a single workgroup, so rows that fit in a single workgroup have none.
+// The sums of a scan of columns are laid out in columns too. (see sat_scan_texel)
+static void CreateSATWorkgroupSumsTextures(GLenum internalFormat, int rowLength, int numRows, int workgroupSize, bool scanColumns, std::vector<GLuint>* wgSumsTOs)
+{
+    for (int length = rowLength; length > workgroupSize; length = GetNumSATWorkgroups(length, workgroupSize))
+    {
+        if (scanColumns) {
+            wgSumsTOs->push_back(CreateSATTexture(internalFormat, numRows, GetNumSATWorkgroups(length, workgroupSize)));
+        }
+        else {
+            wgSumsTOs->push_back(CreateSATTexture(internalFormat, GetNumSATWorkgroups(length, workgroupSize), numRows));
+        }
+    }
+}
+
+static void DeleteSATWorkgroupSumsTextures(std::vector<GLuint>* wgSumsTOs)
+{
+    glDeleteTextures((GLsizei)wgSumsTOs->size(), wgSumsTOs->data());
+    wgSumsTOs->clear();
+}
+
+void GPUSAT::Resize(int width, int height, SATFormat format, int level, int order)
+{
+    mFormat = format;
+    mLevel = level;
+    mOrder = order;
+    mWidth = width;
+    mHeight = height;
+
+    GLenum internalFormat = GetSATInternalFormat(mFormat);
+
+    // The SAT is the size of the (downsampled) image. The scans bounds-check the last (partial) workgroup of each row.
+    mSATWidth = (mWidth + (1 << mLevel) - 1) >> mLevel;
+    mSATHeight = (mHeight + (1 << mLevel) - 1) >> mLevel;
+    if (mOrder > 1)
+    {
+        mSATWidth += SAT_ITERATED_PADDING;
+        mSATHeight += SAT_ITERATED_PADDING;
+    }
+    else if (mFormat != SATFormat_HDR)
+    {
+        // the exclusive SAT has one more row and column, which sum the last column and row of the image.
+        // the scans read 0 past the input.
+        mSATWidth += 1;
+        mSATHeight += 1;
+    }
+    if (mFormat == SATFormat_HDR)
+    {
+        mSATWidth = (mSATWidth + SAT_HDR_TILE_SIZE - 1) / SAT_HDR_TILE_SIZE * SAT_HDR_TILE_SIZE;
+        mSATHeight = (mSATHeight + SAT_HDR_TILE_SIZE - 1) / SAT_HDR_TILE_SIZE * SAT_HDR_TILE_SIZE;
+    }
+
+    glDeleteTextures(1, &mSummedRowsTO);
+    mSummedRowsTO = CreateSATTexture(internalFormat, mSATWidth, mSATHeight);
+
+    DeleteSATWorkgroupSumsTextures(&mSummedRowsWGSumsTOs);
+    DeleteSATWorkgroupSumsTextures(&mInPlaceColsWGSumsTOs);
+
+    // allocated by the first Compute() that transposes the columns
+    glDeleteTextures(1, &mSummedColsTO);
+    mSummedColsTO = 0;
+    DeleteSATWorkgroupSumsTextures(&mSummedColsWGSumsTOs);
+
+    glDeleteBuffers(1, &mScanFlagsBO);
+    mScanFlagsBO = 0;
+    glDeleteBuffers(1, &mScanSumsBO);
+    mScanSumsBO = 0;
+
+    // the HDR SAT is summed in place, so it needs nothing else
+    if (mFormat == SATFormat_HDR)
+    {
+        return;
+    }
+
+    CreateSATWorkgroupSumsTextures(internalFormat, mSATWidth, mSATHeight, mWorkgroupSizes.Scan, false, &mSummedRowsWGSumsTOs);
+    CreateSATWorkgroupSumsTextures(internalFormat, mSATHeight, mSATWidth, mWorkgroupSizes.Scan, true, &mInPlaceColsWGSumsTOs);
+
+    int maxNumChunks = std::max(
+        GetNumSATWorkgroups(mSATWidth, mWorkgroupSizes.Scan) * mSATHeight,
+        GetNumSATWorkgroups(mSATHeight, mWorkgroupSizes.Scan) * mSATWidth);
+
+    // the chunk counter, then one flag per chunk
+    glGenBuffers(1, &mScanFlagsBO);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, mScanFlagsBO);
+    glBufferStorage(GL_SHADER_STORAGE_BUFFER, (1 + maxNumChunks) * sizeof(GLuint), NULL, 0);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    // the aggregate and inclusive prefix of each chunk
+    GLsizeiptr satElementSize = mFormat == SATFormat_Compact ? sizeof(GLuint) * 2 : sizeof(GLuint) * 4;
+    glGenBuffers(1, &mScanSumsBO);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, mScanSumsBO);
+    glBufferStorage(GL_SHADER_STORAGE_BUFFER, maxNumChunks * 2 * satElementSize, NULL, 0);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void GPUSAT::Scan(GLuint upsweepSP, GLuint downsweepSP, GLuint srgbInputTO, GLuint dataTO, const std::vector<GLuint>& wgSumsTOs, int rowLength, int numRows, bool scanColumns)
+{
+    GLenum internalFormat = GetSATInternalFormat(mFormat);
+
+    // levelTOs[0] is the data, and levelTOs[i] holds the workgroup sums of levelTOs[i - 1].
+    std::vector<GLuint> levelTOs(1, dataTO);
+    levelTOs.insert(levelTOs.end(), wgSumsTOs.begin(), wgSumsTOs.end());
+
+    std::vector<int> levelLengths(levelTOs.size());
+    levelLengths[0] = rowLength;
+    for (size_t level = 1; level < levelTOs.size(); level++)
+    {
+        levelLengths[level] = GetNumSATWorkgroups(levelLengths[level - 1], mWorkgroupSizes.Scan);
+    }
+
+    // Up-sweep each level, from the data to the last level of workgroup sums
+    glUseProgram(upsweepSP);
+    glUniform1i(SAT_SCAN_COLUMNS_UNIFORM_LOCATION, scanColumns ? 1 : 0);
+    for (size_t level = 0; level < levelTOs.size(); level++)
+    {
+        glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+
+        if (level == 0 && srgbInputTO != 0) {
+            glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, &srgbInputTO);
+            glUniform1i(SAT_READ_UINT_INPUT_UNIFORM_LOCATION, 0);
+            glUniform1i(SAT_READ_WGSUM_UNIFORM_LOCATION, 0);
+        }
+        else if (level == 0) {
+            glBindTextures(SAT_UINT_INPUT_TEXTURE_BINDING, 1, &dataTO);
+            glUniform1i(SAT_READ_UINT_INPUT_UNIFORM_LOCATION, 1);
+            glUniform1i(SAT_READ_WGSUM_UNIFORM_LOCATION, 0);
+        }
+        else {
+            // the sum of each workgroup of the previous level is the last element of its up-sweep
+            glBindTextures(SAT_UINT_INPUT_TEXTURE_BINDING, 1, &levelTOs[level - 1]);
+            glUniform1i(SAT_READ_UINT_INPUT_UNIFORM_LOCATION, 0);
+            glUniform1i(SAT_READ_WGSUM_UNIFORM_LOCATION, 1);
+        }
+
+        glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, levelTOs[level], 0, GL_TRUE, 0, GL_WRITE_ONLY, internalFormat);
+
+        glDispatchCompute(GetNumSATWorkgroups(levelLengths[level], mWorkgroupSizes.Scan), numRows, 1);
+    }
+    glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, NULL);
+    glBindTextures(SAT_UINT_INPUT_TEXTURE_BINDING, 1, NULL);
+    glBindImageTextures(SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
+    glUseProgram(0);
+
+    // Down-sweep each level, from the last level of workgroup sums back to the data.
+    // The last level fits in a single workgroup, so it's scanned as-is.
+    // Every other level adds the scanned sums of the level above to its workgroups.
+    glUseProgram(downsweepSP);
+    glUniform1i(SAT_SCAN_COLUMNS_UNIFORM_LOCATION, scanColumns ? 1 : 0);
+    for (size_t level = levelTOs.size(); level-- > 0; )
+    {
+        glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+
+        glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, levelTOs[level], 0, GL_TRUE, 0, GL_READ_WRITE, internalFormat);
+
+        if (level + 1 < levelTOs.size()) {
+            glBindImageTexture(SAT_WGSUMS_IMAGE_BINDING, levelTOs[level + 1], 0, GL_TRUE, 0, GL_READ_ONLY, internalFormat);
+            glUniform1i(SAT_ADD_WGSUM_UNIFORM_LOCATION, 1);
+        }
+        else {
+            glUniform1i(SAT_ADD_WGSUM_UNIFORM_LOCATION, 0);
+        }
+
+        glDispatchCompute(GetNumSATWorkgroups(levelLengths[level], mWorkgroupSizes.Scan), numRows, 1);
+    }
+    glBindImageTextures(SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
+    glBindImageTextures(SAT_WGSUMS_IMAGE_BINDING, 1, NULL);
+    glUseProgram(0);
+}
+
+void GPUSAT::ScanLookBack(GLuint srgbInputTO, GLuint dataTO, int rowLength, int numRows, bool scanColumns)
+{
+    GLuint scanSP = *mScanSP[mFormat];
+    GLenum internalFormat = GetSATInternalFormat(mFormat);
+
+    // the flags and the chunk counter start from zero. The sums don't need to, they're only read once flagged.
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, mScanFlagsBO);
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, NULL);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    glUseProgram(scanSP);
+    glUniform1i(SAT_SCAN_COLUMNS_UNIFORM_LOCATION, scanColumns ? 1 : 0);
+
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+
+    if (srgbInputTO != 0) {
+        glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, &srgbInputTO);
+        glUniform1i(SAT_READ_UINT_INPUT_UNIFORM_LOCATION, 0);
+    }
+    else {
+        glBindTextures(SAT_UINT_INPUT_TEXTURE_BINDING, 1, &dataTO);
+        glUniform1i(SAT_READ_UINT_INPUT_UNIFORM_LOCATION, 1);
+    }
+
+    glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, dataTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, internalFormat);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, SAT_SCAN_FLAGS_BUFFER_BINDING, mScanFlagsBO);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, SAT_SCAN_SUMS_BUFFER_BINDING, mScanSumsBO);
+
+    // the shader picks its chunk from a counter, so the shape of the dispatch only matters for its size.
+    glDispatchCompute(GetNumSATWorkgroups(rowLength, mWorkgroupSizes.Scan), numRows, 1);
+
+    glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, NULL);
+    glBindTextures(SAT_UINT_INPUT_TEXTURE_BINDING, 1, NULL);
+    glBindImageTextures(SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, SAT_SCAN_FLAGS_BUFFER_BINDING, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, SAT_SCAN_SUMS_BUFFER_BINDING, 0);
+    glUseProgram(0);
+}
+
+void GPUSAT::Transpose(GLuint inputTO, GLuint outputTO, int inputWidth, int inputHeight, bool tiled, int queryIndex)
+{
+    GLuint transposeSP = tiled ? *mTiledTransposeSP[mFormat] : *mTransposeSP[mFormat];
+    GLenum internalFormat = GetSATInternalFormat(mFormat);
+
+    glQueryCounter(mTransposeTimestampQueries[queryIndex + 0], GL_TIMESTAMP);
+
+    glUseProgram(transposeSP);
+
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+
+    glBindImageTexture(TRANSPOSE_SAT_INPUT_IMAGE_BINDING, inputTO, 0, GL_TRUE, 0, GL_READ_ONLY, internalFormat);
+    glBindImageTexture(TRANSPOSE_SAT_OUTPUT_IMAGE_BINDING, outputTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, internalFormat);
+
+    // the edge tiles are partial, and the shader skips their invocations that are out of bounds.
+    int numTilesX = (inputWidth + mWorkgroupSizes.Transpose - 1) / mWorkgroupSizes.Transpose;
+    int numTilesY = (inputHeight + mWorkgroupSizes.Transpose - 1) / mWorkgroupSizes.Transpose;
+    glDispatchCompute(numTilesX, numTilesY, 1);
+
+    glBindImageTextures(TRANSPOSE_SAT_INPUT_IMAGE_BINDING, 1, NULL);
+    glBindImageTextures(TRANSPOSE_SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
+    glUseProgram(0);
+
+    glQueryCounter(mTransposeTimestampQueries[queryIndex + 1], GL_TIMESTAMP);
+}
+
+void GPUSAT::Downsample(GLuint inputTO)
+{
+    GLuint downsampleSP = *mDownsampleSP[mFormat];
+    GLenum internalFormat = GetSATInternalFormat(mFormat);
+
+    glUseProgram(downsampleSP);
+    glUniform1i(SAT_DOWNSAMPLE_LEVEL_UNIFORM_LOCATION, mLevel);
+
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+
+    glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, &inputTO);
+    glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedRowsTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, internalFormat);
+
+    int numGroupsX = (mSATWidth + SAT_DOWNSAMPLE_WORKGROUP_SIZE_X - 1) / SAT_DOWNSAMPLE_WORKGROUP_SIZE_X;
+    int numGroupsY = (mSATHeight + SAT_DOWNSAMPLE_WORKGROUP_SIZE_X - 1) / SAT_DOWNSAMPLE_WORKGROUP_SIZE_X;
+    glDispatchCompute(numGroupsX, numGroupsY, 1);
+
+    glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, NULL);
+    glBindImageTextures(SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
+    glUseProgram(0);
+}
+
+bool GPUSAT::ComputeHDR(GLuint inputTO)
+{
+    GLuint tilesSP = *mHDRTilesSP;
+    GLuint offsetsSP = *mHDROffsetsSP;
+    // only the full resolution HDR SAT of order 1 is built
+    if (!tilesSP || !offsetsSP || mLevel > 0 || mOrder > 1)
+    {
+        return false;
+    }
+
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+
+    // the sums of each tile
+    glUseProgram(tilesSP);
+    glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, &inputTO);
+    glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedRowsTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA32UI);
+    glDispatchCompute(mSATWidth / SAT_HDR_TILE_SIZE, mSATHeight / SAT_HDR_TILE_SIZE, 1);
+    glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, NULL);
+
+    // the columns below and the rows left of each tile, then the corners below and left of them
+    glUseProgram(offsetsSP);
+    glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedRowsTO, 0, GL_TRUE, 0, GL_READ_WRITE, GL_RGBA32UI);
+
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+    glUniform1i(SAT_HDR_CORNERS_UNIFORM_LOCATION, 0);
+    glDispatchCompute((mSATWidth + mSATHeight + SAT_HDR_OFFSETS_WORKGROUP_SIZE_X - 1) / SAT_HDR_OFFSETS_WORKGROUP_SIZE_X, 1, 1);
+
+    int numTileColumns = mSATWidth / SAT_HDR_TILE_SIZE;
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+    glUniform1i(SAT_HDR_CORNERS_UNIFORM_LOCATION, 1);
+    glDispatchCompute((numTileColumns + SAT_HDR_OFFSETS_WORKGROUP_SIZE_X - 1) / SAT_HDR_OFFSETS_WORKGROUP_SIZE_X, 1, 1);
+
+    glBindImageTextures(SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
+    glUseProgram(0);
+
+    return true;
+}
+
+bool GPUSAT::Compute(GLuint inputTO, SATAlgorithm algorithm, SATColumnPass columnPass)
+{
+    if (mFormat == SATFormat_HDR)
+    {
+        return ComputeHDR(inputTO);
+    }
+
+    // fall back to the kernels without subgroups
+    if (algorithm == SATAlgorithm_Subgroup && !mSubgroupsSupported)
+    {
+        algorithm = SATAlgorithm_UpDownSweep;
+    }
+
+    GLuint upsweepSP = *mUpsweepSP[mFormat];
+    GLuint downsweepSP = *mDownsweepSP[mFormat];
+    if (algorithm == SATAlgorithm_Subgroup)
+    {
+        upsweepSP = *mSubgroupUpsweepSP[mFormat];
+        downsweepSP = *mSubgroupDownsweepSP[mFormat];
+    }
+    else if (algorithm == SATAlgorithm_UpDownSweepPadded)
+    {
+        upsweepSP = *mPaddedUpsweepSP[mFormat];
+        downsweepSP = *mPaddedDownsweepSP[mFormat];
+    }
+
+    GLuint transposeSP = *mTransposeSP[mFormat];
+    GLuint tiledTransposeSP = *mTiledTransposeSP[mFormat];
+    GLuint scanSP = *mScanSP[mFormat];
+    GLuint downsampleSP = *mDownsampleSP[mFormat];
+    if (mLevel > 0 && !downsampleSP)
+    {
+        return false;
+    }
+    if (algorithm != SATAlgorithm_LookBack && (!upsweepSP || !downsweepSP))
+    {
+        return false;
+    }
+    if (algorithm == SATAlgorithm_LookBack && !scanSP)
+    {
+        return false;
+    }
+    if (columnPass == SATColumnPass_Transpose && !transposeSP)
+    {
+        return false;
+    }
+    if (columnPass == SATColumnPass_TiledTranspose && !tiledTransposeSP)
+    {
+        return false;
+    }
+
+    // The downsampled image is scanned in place.
+    GLuint rowsInputTO = inputTO;
+    if (mLevel > 0)
+    {
+        Downsample(inputTO);
+        rowsInputTO = 0;
+    }
+
+    for (int order = 1; order <= mOrder; order++)
+    {
+        // Rows
+        if (algorithm == SATAlgorithm_LookBack) {
+            ScanLookBack(rowsInputTO, mSummedRowsTO, mSATWidth, mSATHeight, false);
+        }
+        else {
+            Scan(upsweepSP, downsweepSP, rowsInputTO, mSummedRowsTO, mSummedRowsWGSumsTOs, mSATWidth, mSATHeight, false);
+        }
+
+        // Columns
+        if (columnPass == SATColumnPass_InPlace)
+        {
+            if (algorithm == SATAlgorithm_LookBack) {
+                ScanLookBack(0, mSummedRowsTO, mSATHeight, mSATWidth, true);
+            }
+            else {
+                Scan(upsweepSP, downsweepSP, 0, mSummedRowsTO, mInPlaceColsWGSumsTOs, mSATHeight, mSATWidth, true);
+            }
+        }
+        else if (columnPass == SATColumnPass_Transpose || columnPass == SATColumnPass_TiledTranspose)
+        {
+            bool tiled = columnPass == SATColumnPass_TiledTranspose;
+
+            if (!mSummedColsTO)
+            {
+                GLenum internalFormat = GetSATInternalFormat(mFormat);
+                mSummedColsTO = CreateSATTexture(internalFormat, mSATHeight, mSATWidth);
+                CreateSATWorkgroupSumsTextures(internalFormat, mSATHeight, mSATWidth, mWorkgroupSizes.Scan, false, &mSummedColsWGSumsTOs);
+            }
+
+            Transpose(mSummedRowsTO, mSummedColsTO, mSATWidth, mSATHeight, tiled, 0);
+
+            if (algorithm == SATAlgorithm_LookBack) {
+                ScanLookBack(0, mSummedColsTO, mSATHeight, mSATWidth, false);
+            }
+            else {
+                Scan(upsweepSP, downsweepSP, 0, mSummedColsTO, mSummedColsWGSumsTOs, mSATHeight, mSATWidth, false);
+            }
+
+            Transpose(mSummedColsTO, mSummedRowsTO, mSATHeight, mSATWidth, tiled, 2);
+            mTransposeTimestampsIssued = true;
+        }
+
+        // the next order sums this one in place
+        rowsInputTO = 0;
+    }
+
+    return true;
+}
+
+void GPUSAT::Release()
+{
+    glDeleteTextures(1, &mSummedRowsTO);
+    mSummedRowsTO = 0;
+    DeleteSATWorkgroupSumsTextures(&mSummedRowsWGSumsTOs);
+    DeleteSATWorkgroupSumsTextures(&mInPlaceColsWGSumsTOs);
+
+    glDeleteTextures(1, &mSummedColsTO);
+    mSummedColsTO = 0;
+    DeleteSATWorkgroupSumsTextures(&mSummedColsWGSumsTOs);
+
+    glDeleteBuffers(1, &mScanFlagsBO);
+    mScanFlagsBO = 0;
+    glDeleteBuffers(1, &mScanSumsBO);
+    mScanSumsBO = 0;
+
+    glDeleteQueries(4, &mTransposeTimestampQueries[0]);
+    mTransposeTimestampsIssued = false;
+}
+
+GLuint GPUSAT::GetSATTexture() const
+{
+    return mSummedRowsTO;
+}
+
+bool GPUSAT::IsAlgorithmSupported(SATAlgorithm algorithm) const
+{
+    if (algorithm == SATAlgorithm_Subgroup)
+    {
+        return mSubgroupsSupported;
+    }
+
+    return true;
+}
+
+SATFormat GPUSAT::GetFormat() const
+{
+    return mFormat;
+}
+
+int GPUSAT::GetLevel() const
+{
+    return mLevel;
+}
+
+int GPUSAT::GetOrder() const
+{
+    return mOrder;
+}
+
+SATWorkgroupSizes GPUSAT::GetWorkgroupSizes() const
+{
+    return mWorkgroupSizes;
+}
+
+bool GPUSAT::GetTransposeTime(uint64_t* ns) const
+{
+    if (!mTransposeTimestampsIssued)
+    {
+        return false;
+    }
+
+    GLuint64 timestamps[4];
+    for (int i = 0; i < 4; i++)
+    {
+        glGetQueryObjectui64v(mTransposeTimestampQueries[i], GL_QUERY_RESULT, &timestamps[i]);
+    }
+
+    *ns = (timestamps[1] - timestamps[0]) + (timestamps[3] - timestamps[2]);
+    return true;
+}
+
+int GPUSAT::GetSATWidth() const
+{
+    return mSATWidth;
+}
+
+int GPUSAT::GetSATHeight() const
+{
+    return mSATHeight;
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "opengl.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ShaderSet;
+
+// Storage formats of the SAT. See SAT_FORMAT_* in preamble.glsl.
+enum SATFormat
+{
+    SATFormat_RGBA32UI,
+    SATFormat_Compact,
+    // The SAT of a linear float (HDR) image, split relative to its tiles. It isn't scanned, so it ignores SATAlgorithm and SATColumnPass,
+    // and it's only built at full resolution and order 1. (see GPUSAT::ComputeHDR)
+    SATFormat_HDR,
+    SATFormat_Count
+};
+
+const char* GetSATFormatName(SATFormat format);
+
+// The texture format the SAT is stored in.
+GLenum GetSATInternalFormat(SATFormat format);
+
+// Defines to compile the programs that read the SAT with. (see ShaderSet::AddProgram)
+std::string GetSATFormatDefines(SATFormat format);
+
+// Workgroup sizes of the SAT programs. The best ones depend on the GPU. (see gpu_sat_tuning.h)
+struct SATWorkgroupSizes
+{
+    // The number of elements of a row scanned by each workgroup (SAT_WORKGROUP_SIZE_X). A power of two.
+    int Scan;
+    // The width and height of the tiles of the transposes (TRANSPOSE_SAT_WORKGROUP_SIZE_X).
+    int Transpose;
+};
+
+// The workgroup sizes in preamble.glsl.
+SATWorkgroupSizes GetDefaultSATWorkgroupSizes();
+
+// Defines to compile the SAT programs with, overriding the workgroup sizes in preamble.glsl.
+std::string GetSATWorkgroupSizesDefines(const SATWorkgroupSizes& sizes);
+
+// Ways to scan the rows of the SAT.
+enum SATAlgorithm
+{
+    // Up-sweeps and down-sweeps the rows, then their workgroup sums (sat_up.comp, sat_down.comp).
+    SATAlgorithm_UpDownSweep,
+    // Scans each row in a single dispatch, with each workgroup looking back at the sums of the ones before it (sat_scan.comp).
+    // Reads and writes each element once.
+    SATAlgorithm_LookBack,
+    // Up-sweeps and down-sweeps like SATAlgorithm_UpDownSweep, but each workgroup is scanned with subgroup arithmetic,
+    // with two barriers instead of two per level of the tree (sat_up_subgroup.comp, sat_down_subgroup.comp).
+    // Needs GL_KHR_shader_subgroup_arithmetic, falls back to SATAlgorithm_UpDownSweep without it.
+    SATAlgorithm_Subgroup,
+    // Up-sweeps and down-sweeps like SATAlgorithm_UpDownSweep, but each tree is kept in place in a single shared buffer,
+    // padded against bank conflicts, instead of two (sat_up_padded.comp, sat_down_padded.comp).
+    // Uses about half the shared memory, so more workgroups can be resident at once.
+    SATAlgorithm_UpDownSweepPadded,
+    SATAlgorithm_Count
+};
+
+const char* GetSATAlgorithmName(SATAlgorithm algorithm);
+
+// Ways to scan the columns of the SAT, once its rows are scanned.
+enum SATColumnPass
+{
+    // Scans the columns where they are, reading and writing the image along y.
+    SATColumnPass_InPlace,
+    // Transposes the image so the columns are scanned as rows, then transposes it back (sat_transpose.comp).
+    // Needs a second SAT-sized texture.
+    SATColumnPass_Transpose,
+    // Same, but each transpose goes through tiles in shared memory, so that both its reads and writes
+    // are along rows (sat_transpose_tiled.comp).
+    SATColumnPass_TiledTranspose,
+    SATColumnPass_Count
+};
+
+const char* GetSATColumnPassName(SATColumnPass columnPass);
+
+// Which levels of the SAT pyramid are built. Level i is the SAT of the image downsampled by 2^i. (see DOF_SAT_LEVEL_COUNT)
+// The DoF blurs with the coarsest level that was built and is fine enough for the blur radius.
+enum SATPyramid
+{
+    SATPyramid_Full,
+    SATPyramid_FullHalfQuarter,
+    // Without the full resolution level, even the pixels in focus are blurred over a block. For low-end GPUs.
+    SATPyramid_HalfQuarter,
+    SATPyramid_Quarter,
+    SATPyramid_Count
+};
+
+const char* GetSATPyramidName(SATPyramid pyramid);
+
+// The mask of the levels that are built (bit i is level i).
+int GetSATPyramidLevels(SATPyramid pyramid);
+
+// Computes the summed area table (SAT) of the backbuffer with compute shaders.
+// The SAT is built in two passes, one for the rows and one for the columns. Each pass:
+// 1. Up-sweeps (reduces) the rows in workgroup-sized chunks (sat_up.comp).
+// 2. Up-sweeps the totals of each chunk the same way, then the totals of those chunks, and so on,
+//    until a level fits in a single workgroup (sat_up.comp).
+// 3. Down-sweeps each level, from the last one back to the rows, adding the scanned totals
+//    of the level above to the chunks (sat_down.comp).
+// SATAlgorithm_LookBack does all 3 steps in a single dispatch.
+// The columns are scanned the same way, either in place or after transposing them into rows. (see SATColumnPass)
+// The resulting SAT is exclusive: texel (x,y) holds the sum of [0,x)x[0,y).
+// An iterated SAT of a higher order repeats both passes over the SAT of the order below, in place.
+// The HDR SAT is built differently, and is inclusive. (see SAT_FORMAT_HDR)
+class GPUSAT
+{
+    GLuint* mUpsweepSP[SATFormat_Count];
+    GLuint* mDownsweepSP[SATFormat_Count];
+    GLuint* mTransposeSP[SATFormat_Count];
+    GLuint* mTiledTransposeSP[SATFormat_Count];
+    GLuint* mScanSP[SATFormat_Count];
+    // only added if subgroups are supported
+    GLuint* mSubgroupUpsweepSP[SATFormat_Count];
+    GLuint* mSubgroupDownsweepSP[SATFormat_Count];
+    bool mSubgroupsSupported;
+    GLuint* mPaddedUpsweepSP[SATFormat_Count];
+    GLuint* mPaddedDownsweepSP[SATFormat_Count];
+    GLuint* mDownsampleSP[SATFormat_Count];
+    GLuint* mHDRTilesSP;
+    GLuint* mHDROffsetsSP;
+
+    SATWorkgroupSizes mWorkgroupSizes;
+
+    SATFormat mFormat;
+    int mLevel;
+    int mOrder;
+    int mWidth;
+    int mHeight;
+    int mSATWidth;
+    int mSATHeight;
+
+    GLuint mSummedRowsTO; // also holds the final SAT
+    // The workgroup sums of each level of the scan of the rows, and of the columns scanned in place.
+    // Level i+1 holds the sums of the workgroups of level i, and the last level fits in a single workgroup.
+    std::vector<GLuint> mSummedRowsWGSumsTOs;
+    std::vector<GLuint> mInPlaceColsWGSumsTOs;
+
+    // The transposed SAT, and the workgroup sums of its scan. Only allocated once the columns are transposed.
+    GLuint mSummedColsTO;
+    std::vector<GLuint> mSummedColsWGSumsTOs;
+
+    // The state of each chunk of the rows scanned by SATAlgorithm_LookBack. Sized for the pass with the most chunks.
+    GLuint mScanFlagsBO;
+    GLuint mScanSumsBO;
+
+    // Scans the rows (or columns) of dataTO in place, or the rows of srgbInputTO into dataTO if it isn't 0.
+    // upsweepSP and downsweepSP are one of the pairs of up/down-sweep programs.
+    void Scan(GLuint upsweepSP, GLuint downsweepSP, GLuint srgbInputTO, GLuint dataTO, const std::vector<GLuint>& wgSumsTOs, int rowLength, int numRows, bool scanColumns);
+    void ScanLookBack(GLuint srgbInputTO, GLuint dataTO, int rowLength, int numRows, bool scanColumns);
+
+    // Timestamps around the two transposes of the last Compute() that transposed the columns.
+    GLuint mTransposeTimestampQueries[4];
+    bool mTransposeTimestampsIssued;
+
+    // Transposes inputTO into outputTO. The transpose is timed by mTransposeTimestampQueries[queryIndex] and the one after it.
+    void Transpose(GLuint inputTO, GLuint outputTO, int inputWidth, int inputHeight, bool tiled, int queryIndex);
+
+    // Sums each block of inputTO into an element of mSummedRowsTO, for a SAT with a level above 0.
+    void Downsample(GLuint inputTO);
+
+    // Sums each tile of inputTO (sat_hdr_tiles.comp), then the tiles below and left of each tile (sat_hdr_offsets.comp).
+    bool ComputeHDR(GLuint inputTO);
+
+public:
+    // Adds the SAT programs (for every format) to the shader set. They're compiled by the next ShaderSet::UpdatePrograms().
+    // The programs are specialized for the given workgroup sizes.
+    void Init(ShaderSet* shaders, const SATWorkgroupSizes& workgroupSizes);
+
+    // (Re)allocates the textures for an input image of the given size, in the given format.
+    // With a level above 0, the SAT is of the image downsampled by 2^level: each of its texels sums a 2^level x 2^level block.
+    // (see DOF_SAT_LEVEL_COUNT)
+    // With an order above 1, the SAT is summed again order - 1 times, and padded past the image. (see SAT_ITERATED_PADDING)
+    void Resize(int width, int height, SATFormat format, int level = 0, int order = 1);
+
+    // Dispatches the SAT of inputTO, an 8-bit sRGB texture of the size given to Resize(), or a float texture for SATFormat_HDR.
+    // Returns false (and dispatches nothing) if the programs failed to compile.
+    bool Compute(GLuint inputTO, SATAlgorithm algorithm, SATColumnPass columnPass);
+
+    // The texture that holds the SAT after Compute(), in the format given to Resize().
+    // It is GetSATWidth() x GetSATHeight() texels, the size of the input image divided by 2^level (rounded up),
+    // plus a row and column past the image (so that its last row and column are summed), or the padding of iterated SATs.
+    // The HDR SAT is padded to whole tiles instead.
+    GLuint GetSATTexture() const;
+
+    // Deletes the textures, buffers and queries. The programs belong to the shader set, so they're left alone.
+    void Release();
+
+    // Whether the algorithm can be used as-is by Compute(), rather than falling back to another one.
+    bool IsAlgorithmSupported(SATAlgorithm algorithm) const;
+
+    SATFormat GetFormat() const;
+    int GetLevel() const;
+    int GetOrder() const;
+    SATWorkgroupSizes GetWorkgroupSizes() const;
+
+    // The GPU time of the transposes of the last Compute() that transposed the columns, in nanoseconds.
+    // Waits for the transposes to finish, so it should be called a frame later. Returns false if nothing was transposed yet.
+    bool GetTransposeTime(uint64_t* ns) const;
+
+    int GetSATWidth() const;
+    int GetSATHeight() const;
+};
\ No newline at end of file
@@ -0,0 +1,236 @@
+#include "gpu_sat_tuning.h"
+
+#include "shaderset.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Every GL 4.3 implementation supports workgroups of 1024 invocations, so all of these compile everywhere.
+// The scans need powers of two. The transposes are square, so they're at most 32x32.
+static const int kScanWorkgroupSizes[] = { 128, 256, 512, 1024 };
+static const int kTransposeWorkgroupSizes[] = { 8, 16, 32 };
+
+static const int kTuningWidth = 1920;
+static const int kTuningHeight = 1080;
+static const int kTuningWarmupIterations = 2;
+static const int kTuningIterations = 8;
+
+template<size_t N>
+static bool IsCandidate(const int (&candidates)[N], int size)
+{
+    return std::find(candidates, candidates + N, size) != candidates + N;
+}
+
+static bool LoadCachedSATWorkgroupSizes(const char* cacheFilename, const char* renderer, SATWorkgroupSizes* sizes)
+{
+    // not an error, the cache doesn't exist until the first GPU is tuned
+    FILE* fp = fopen(cacheFilename, "r");
+    if (!fp)
+    {
+        return false;
+    }
+
+    // each line is "<scan size> <transpose size> <GL_RENDERER>". Later lines take precedence.
+    bool found = false;
+    char line[512];
+    while (fgets(line, sizeof(line), fp))
+    {
+        int scan, transpose, rendererOffset;
+        if (sscanf(line, "%d %d %n", &scan, &transpose, &rendererOffset) != 2)
+        {
+            continue;
+        }
+
+        char* lineRenderer = line + rendererOffset;
+        lineRenderer[strcspn(lineRenderer, "\r\n")] = '\0';
+        if (strcmp(lineRenderer, renderer) != 0)
+        {
+            continue;
+        }
+
+        // ignore sizes from another version of the candidates
+        if (!IsCandidate(kScanWorkgroupSizes, scan) ||
+            !IsCandidate(kTransposeWorkgroupSizes, transpose))
+        {
+            continue;
+        }
+
+        sizes->Scan = scan;
+        sizes->Transpose = transpose;
+        found = true;
+    }
+
+    fclose(fp);
+    return found;
+}
+
+static void SaveCachedSATWorkgroupSizes(const char* cacheFilename, const char* renderer, const SATWorkgroupSizes& sizes)
+{
+    FILE* fp = fopen(cacheFilename, "a");
+    if (!fp)
+    {
+        perror(cacheFilename);
+        return;
+    }
+
+    fprintf(fp, "%d %d %s\n", sizes.Scan, sizes.Transpose, renderer);
+    fclose(fp);
+}
+
+// The median GPU time of computing the SAT of inputTO with the up/down-sweep, in nanoseconds.
+// Returns false if the programs failed to compile.
+static bool TimeSAT(GPUSAT* gpuSAT, GLuint inputTO, SATColumnPass columnPass, uint64_t* ns)
+{
+    GLuint queries[kTuningIterations * 2];
+    glGenQueries(kTuningIterations * 2, &queries[0]);
+
+    bool compiled = true;
+    for (int iteration = 0; iteration < kTuningWarmupIterations + kTuningIterations; iteration++)
+    {
+        int timedIteration = iteration - kTuningWarmupIterations;
+
+        if (timedIteration >= 0)
+        {
+            glQueryCounter(queries[timedIteration * 2 + 0], GL_TIMESTAMP);
+        }
+
+        if (!gpuSAT->Compute(inputTO, SATAlgorithm_UpDownSweep, columnPass))
+        {
+            compiled = false;
+            break;
+        }
+
+        if (timedIteration >= 0)
+        {
+            glQueryCounter(queries[timedIteration * 2 + 1], GL_TIMESTAMP);
+        }
+    }
+
+    if (compiled)
+    {
+        std::vector<uint64_t> samples(kTuningIterations);
+        for (int iteration = 0; iteration < kTuningIterations; iteration++)
+        {
+            GLuint64 start, end;
+            glGetQueryObjectui64v(queries[iteration * 2 + 0], GL_QUERY_RESULT, &start);
+            glGetQueryObjectui64v(queries[iteration * 2 + 1], GL_QUERY_RESULT, &end);
+            samples[iteration] = end - start;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        *ns = samples[kTuningIterations / 2];
+    }
+
+    glDeleteQueries(kTuningIterations * 2, &queries[0]);
+    return compiled;
+}
+
+// Times each candidate and returns the fastest one, or -1 if none of them compiled.
+// The candidates are compiled in their own shader set, so the ones that lose don't stay in the caller's.
+static int TuneSATWorkgroupSizes(const std::string& version, const std::string& preambleFilename, GLuint inputTO, SATColumnPass columnPass, const std::vector<SATWorkgroupSizes>& candidates)
+{
+    ShaderSet shaders;
+    shaders.SetVersion(version);
+    shaders.SetPreambleFile(preambleFilename);
+
+    std::vector<GPUSAT> gpuSATs(candidates.size());
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        gpuSATs[i].Init(&shaders, candidates[i]);
+    }
+    shaders.UpdatePrograms();
+
+    int best = -1;
+    uint64_t bestNs = 0;
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        // one at a time, so there's only ever one set of SAT textures
+        gpuSATs[i].Resize(kTuningWidth, kTuningHeight, SATFormat_RGBA32UI);
+
+        uint64_t ns;
+        if (TimeSAT(&gpuSATs[i], inputTO, columnPass, &ns))
+        {
+            printf("SAT workgroup sizes %d, %dx%d: %.3f milliseconds\n",
+                candidates[i].Scan, candidates[i].Transpose, candidates[i].Transpose, ns / 1000000.0);
+
+            if (best == -1 || ns < bestNs)
+            {
+                best = (int)i;
+                bestNs = ns;
+            }
+        }
+
+        gpuSATs[i].Release();
+    }
+
+    return best;
+}
+
+SATWorkgroupSizes LoadOrTuneSATWorkgroupSizes(const char* cacheFilename, const std::string& version, const std::string& preambleFilename)
+{
+    const char* renderer = (const char*)glGetString(GL_RENDERER);
+
+    SATWorkgroupSizes sizes = GetDefaultSATWorkgroupSizes();
+    if (LoadCachedSATWorkgroupSizes(cacheFilename, renderer, &sizes))
+    {
+        return sizes;
+    }
+
+    printf("Tuning the SAT workgroup sizes for %s\n", renderer);
+
+    // any image will do, the time of the SAT doesn't depend on its contents
+    std::vector<uint32_t> pixels(kTuningWidth * kTuningHeight);
+    for (size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = (uint32_t)i * 2654435761u;
+    }
+
+    GLuint inputTO;
+    glGenTextures(1, &inputTO);
+    glBindTexture(GL_TEXTURE_2D, inputTO);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_SRGB8_ALPHA8, kTuningWidth, kTuningHeight);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kTuningWidth, kTuningHeight, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // The scans and the transposes are independent, so they're tuned one after the other rather than together.
+    // The scans are timed with the columns scanned in place, so the transposes don't count.
+    std::vector<SATWorkgroupSizes> candidates;
+    for (int scan : kScanWorkgroupSizes)
+    {
+        candidates.push_back(sizes);
+        candidates.back().Scan = scan;
+    }
+
+    int best = TuneSATWorkgroupSizes(version, preambleFilename, inputTO, SATColumnPass_InPlace, candidates);
+    if (best != -1)
+    {
+        sizes = candidates[best];
+
+        candidates.clear();
+        for (int transpose : kTransposeWorkgroupSizes)
+        {
+            candidates.push_back(sizes);
+            candidates.back().Transpose = transpose;
+        }
+
+        best = TuneSATWorkgroupSizes(version, preambleFilename, inputTO, SATColumnPass_TiledTranspose, candidates);
+        if (best != -1)
+        {
+            sizes = candidates[best];
+        }
+    }
+
+    glDeleteTextures(1, &inputTO);
+
+    // if nothing compiled, there's nothing to tune yet. Try again next time.
+    if (best == -1)
+    {
+        return GetDefaultSATWorkgroupSizes();
+    }
+
+    printf("Using SAT workgroup sizes %d, %dx%d\n", sizes.Scan, sizes.Transpose, sizes.Transpose);
+    SaveCachedSATWorkgroupSizes(cacheFilename, renderer, sizes);
+    return sizes;
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "gpu_sat.h"
+
+#include <string>
+
+// Picks the fastest SAT workgroup sizes for the current GL context's GPU.
+// The sizes are cached per GL_RENDERER in cacheFilename, one line per GPU.
+// The first time a GPU is seen, the SAT programs are compiled with each candidate size and timed on a 1080p image,
+// and the fastest sizes are added to the cache. Delete its line (or the file) to tune again, for example after a driver update.
+// version and preambleFilename are what the shader set is configured with. (see ShaderSet::SetVersion and ShaderSet::SetPreambleFile)
+SATWorkgroupSizes LoadOrTuneSATWorkgroupSizes(const char* cacheFilename, const std::string& version, const std::string& preambleFilename);
\ No newline at end of file
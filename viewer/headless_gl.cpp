@@ -0,0 +1,241 @@
+#include "headless_gl.h"
+
+#include "opengl.h"
+
+#include <SDL.h>
+
+#if HEADLESS_GL_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+
+#if HEADLESS_GL_EGL
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+static EGLDisplay sEGLDisplay = EGL_NO_DISPLAY;
+static EGLContext sEGLContext = EGL_NO_CONTEXT;
+static EGLSurface sEGLSurface = EGL_NO_SURFACE;
+
+static bool HasEGLExtension(EGLDisplay display, const char* extension)
+{
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+    if (!extensions)
+    {
+        return false;
+    }
+
+    size_t length = strlen(extension);
+    for (const char* found = strstr(extensions, extension); found; found = strstr(found + length, extension))
+    {
+        if ((found == extensions || found[-1] == ' ') && (found[length] == ' ' || found[length] == '\0'))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void* GetEGLProcAddress(const char* proc)
+{
+    return (void*)eglGetProcAddress(proc);
+}
+
+// Makes a context current on the display, without any surface if the display allows it, or with a 1x1 pbuffer.
+static bool CreateEGLContext(EGLDisplay display)
+{
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL))
+    {
+        return false;
+    }
+
+    bool surfaceless = HasEGLExtension(display, "EGL_KHR_surfaceless_context");
+
+    EGLConfig config = NULL;
+    EGLint configCount = 0;
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0)
+    {
+        // all the rendering goes to textures, so a surfaceless context doesn't need a config
+        if (!surfaceless || !HasEGLExtension(display, "EGL_KHR_no_config_context"))
+        {
+            eglTerminate(display);
+            return false;
+        }
+        config = NULL;
+    }
+
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR, 4,
+        EGL_CONTEXT_MINOR_VERSION_KHR, 4,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+        EGL_NONE
+    };
+    EGLContext context = EGL_NO_CONTEXT;
+    if (eglBindAPI(EGL_OPENGL_API))
+    {
+        context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    }
+    if (context == EGL_NO_CONTEXT)
+    {
+        eglTerminate(display);
+        return false;
+    }
+
+    EGLSurface surface = EGL_NO_SURFACE;
+    if (!surfaceless)
+    {
+        const EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        surface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+    }
+
+    if ((!surfaceless && surface == EGL_NO_SURFACE) || !eglMakeCurrent(display, surface, surface, context))
+    {
+        if (surface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(display, surface);
+        }
+        eglDestroyContext(display, context);
+        eglTerminate(display);
+        return false;
+    }
+
+    sEGLDisplay = display;
+    sEGLContext = context;
+    sEGLSurface = surface;
+    return true;
+}
+
+static bool CreateEGLContext()
+{
+    // the platform extensions are client extensions, which are queried without a display
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = NULL;
+    if (HasEGLExtension(EGL_NO_DISPLAY, "EGL_EXT_platform_base"))
+    {
+        getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    }
+
+    if (getPlatformDisplay)
+    {
+        if (HasEGLExtension(EGL_NO_DISPLAY, "EGL_MESA_platform_surfaceless"))
+        {
+            if (CreateEGLContext(getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL)))
+            {
+                return true;
+            }
+        }
+
+        PFNEGLQUERYDEVICESEXTPROC queryDevices = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+        if (queryDevices && HasEGLExtension(EGL_NO_DISPLAY, "EGL_EXT_platform_device"))
+        {
+            EGLDeviceEXT devices[16];
+            EGLint deviceCount = 0;
+            if (queryDevices(16, devices, &deviceCount))
+            {
+                for (int i = 0; i < deviceCount; i++)
+                {
+                    if (CreateEGLContext(getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[i], NULL)))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    return CreateEGLContext(eglGetDisplay(EGL_DEFAULT_DISPLAY));
+}
+#endif
+
+static SDL_Window* sWindow;
+static SDL_GLContext sSDLContext;
+
+static bool CreateSDLContext(const char* name)
+{
+    if (SDL_Init(SDL_INIT_VIDEO))
+    {
+        fprintf(stderr, "SDL_Init: %s\n", SDL_GetError());
+        return false;
+    }
+
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 4);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+
+    // Only used to get a GL context, all the work happens in textures.
+    sWindow = SDL_CreateWindow(name, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 1, 1, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    if (!sWindow)
+    {
+        fprintf(stderr, "SDL_CreateWindow: %s\n", SDL_GetError());
+        SDL_Quit();
+        return false;
+    }
+
+    sSDLContext = SDL_GL_CreateContext(sWindow);
+    if (!sSDLContext)
+    {
+        fprintf(stderr, "SDL_GL_CreateContext: %s\n", SDL_GetError());
+        SDL_DestroyWindow(sWindow);
+        sWindow = NULL;
+        SDL_Quit();
+        return false;
+    }
+
+    return true;
+}
+
+bool CreateHeadlessGLContext(const char* name)
+{
+#if HEADLESS_GL_EGL
+    if (CreateEGLContext())
+    {
+        OpenGL_Init(GetEGLProcAddress);
+        return true;
+    }
+#endif
+
+    if (!CreateSDLContext(name))
+    {
+        return false;
+    }
+
+    OpenGL_Init();
+    return true;
+}
+
+void DestroyHeadlessGLContext()
+{
+#if HEADLESS_GL_EGL
+    if (sEGLDisplay != EGL_NO_DISPLAY)
+    {
+        eglMakeCurrent(sEGLDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (sEGLSurface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(sEGLDisplay, sEGLSurface);
+        }
+        eglDestroyContext(sEGLDisplay, sEGLContext);
+        eglTerminate(sEGLDisplay);
+        sEGLDisplay = EGL_NO_DISPLAY;
+        sEGLContext = EGL_NO_CONTEXT;
+        sEGLSurface = EGL_NO_SURFACE;
+    }
+#endif
+
+    if (sWindow)
+    {
+        SDL_GL_DeleteContext(sSDLContext);
+        SDL_DestroyWindow(sWindow);
+        sSDLContext = NULL;
+        sWindow = NULL;
+        SDL_Quit();
+    }
+}
\ No newline at end of file
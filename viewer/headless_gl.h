@@ -0,0 +1,23 @@
+#pragma once
+
+// An OpenGL 4.4 core context for the offline tools, which don't show anything on screen.
+// A context without any window is tried first, so the tools also run without a display server (eg. on CI machines):
+// EGL's surfaceless platform (Mesa), then its device platform (NVIDIA), then its default display.
+// EGL is only tried where the desktop GL drivers provide it (see HEADLESS_GL_EGL). Otherwise, or if EGL fails,
+// the context belongs to a hidden SDL window.
+// The GL functions are loaded once the context is current. (see OpenGL_Init)
+
+#ifndef HEADLESS_GL_EGL
+#ifdef __linux__
+#define HEADLESS_GL_EGL 1
+#else
+#define HEADLESS_GL_EGL 0
+#endif
+#endif
+
+// Returns false on failure, and prints the cause to stderr.
+// The name is the title of the hidden window, if it comes to that.
+bool CreateHeadlessGLContext(const char* name);
+
+// Destroys the context, and the window or display that came with it.
+void DestroyHeadlessGLContext();
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "image_io.h"
+
+#include "stb_image.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <utility>
+
+bool LoadImageRGBA8(const char* filename, std::vector<glm::u8vec4>* pixels, int* width, int* height)
+{
+    int comp;
+    stbi_uc* img = stbi_load(filename, width, height, &comp, 4);
+    if (!img)
+    {
+        fprintf(stderr, "stbi_load(%s): %s\n", filename, stbi_failure_reason());
+        return false;
+    }
+
+    // files are stored top row first
+    pixels->resize(*width * *height);
+    for (int y = 0; y < *height; y++)
+    {
+        memcpy(&(*pixels)[y * *width], &img[(*height - 1 - y) * *width * 4], *width * 4);
+    }
+
+    stbi_image_free(img);
+    return true;
+}
+
+bool LoadImagePFM(const char* filename, std::vector<float>* pixels, int* width, int* height)
+{
+    FILE* fp = fopen(filename, "rb");
+    if (!fp)
+    {
+        perror(filename);
+        return false;
+    }
+
+    char magic[3] = {};
+    float scale;
+    if (fscanf(fp, "%2s %d %d %f", magic, width, height, &scale) != 4 || strcmp(magic, "Pf") != 0 ||
+        *width <= 0 || *height <= 0 || fgetc(fp) == EOF)
+    {
+        fprintf(stderr, "%s: not a single channel PFM file\n", filename);
+        fclose(fp);
+        return false;
+    }
+
+    // PFM rows are stored bottom row first, which is what we want.
+    pixels->resize(*width * *height);
+    if (fread(pixels->data(), sizeof(float), pixels->size(), fp) != pixels->size())
+    {
+        fprintf(stderr, "%s: unexpected end of file\n", filename);
+        fclose(fp);
+        return false;
+    }
+    fclose(fp);
+
+    // a negative scale means little endian data
+    uint16_t endianTest = 1;
+    bool hostIsLittleEndian = *(uint8_t*)&endianTest == 1;
+    if ((scale < 0.0f) != hostIsLittleEndian)
+    {
+        for (float& f : *pixels)
+        {
+            uint8_t* bytes = (uint8_t*)&f;
+            std::swap(bytes[0], bytes[3]);
+            std::swap(bytes[1], bytes[2]);
+        }
+    }
+
+    return true;
+}
+
+bool SaveImagePPM(const char* filename, const glm::u8vec4* pixels, int width, int height)
+{
+    FILE* fp = fopen(filename, "wb");
+    if (!fp)
+    {
+        perror(filename);
+        return false;
+    }
+
+    fprintf(fp, "P6\n%d %d\n255\n", width, height);
+
+    // files are stored top row first
+    std::vector<uint8_t> row(width * 3);
+    for (int y = height - 1; y >= 0; y--)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            row[x * 3 + 0] = pixels[y * width + x].r;
+            row[x * 3 + 1] = pixels[y * width + x].g;
+            row[x * 3 + 2] = pixels[y * width + x].b;
+        }
+        fwrite(row.data(), 1, row.size(), fp);
+    }
+
+    bool ok = !ferror(fp);
+    fclose(fp);
+
+    if (!ok)
+    {
+        fprintf(stderr, "%s: write error\n", filename);
+    }
+    return ok;
+}
+
+bool SaveImagePFM(const char* filename, const float* pixels, int width, int height)
+{
+    FILE* fp = fopen(filename, "wb");
+    if (!fp)
+    {
+        perror(filename);
+        return false;
+    }
+
+    uint16_t endianTest = 1;
+    bool hostIsLittleEndian = *(uint8_t*)&endianTest == 1;
+    fprintf(fp, "Pf\n%d %d\n%s\n", width, height, hostIsLittleEndian ? "-1.0" : "1.0");
+
+    // PFM rows are stored bottom row first, same as in memory.
+    fwrite(pixels, sizeof(float), width * height, fp);
+
+    bool ok = !ferror(fp);
+    fclose(fp);
+
+    if (!ok)
+    {
+        fprintf(stderr, "%s: write error\n", filename);
+    }
+    return ok;
+}
\ No newline at end of file
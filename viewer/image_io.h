@@ -0,0 +1,21 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+// Minimal image file loading and saving, used by the offline tools.
+// All images in memory follow GL conventions: the first row is the bottom of the image.
+// Functions return true on success, and print the cause of failures to stderr.
+
+// Loads any format supported by stb_image (PNG, TGA, BMP, PPM, ...) as 8-bit RGBA.
+bool LoadImageRGBA8(const char* filename, std::vector<glm::u8vec4>* pixels, int* width, int* height);
+
+// Loads a single channel Portable Float Map ("Pf" header). Used for depth buffers.
+bool LoadImagePFM(const char* filename, std::vector<float>* pixels, int* width, int* height);
+
+// Saves the RGB channels as a binary PPM.
+bool SaveImagePPM(const char* filename, const glm::u8vec4* pixels, int width, int height);
+
+// Saves a single channel Portable Float Map.
+bool SaveImagePFM(const char* filename, const float* pixels, int width, int height);
\ No newline at end of file
@@ -710,704 +710,709 @@ void (GLAPIENTRYP glTexPageCommitmentARB)(GLenum target, GLint level, GLint xoff
 
 void OpenGL_Init()
 {
-	PROC_CAST glCullFace = SDL_GL_GetProcAddress("glCullFace");
-	PROC_CAST glFrontFace = SDL_GL_GetProcAddress("glFrontFace");
-	PROC_CAST glHint = SDL_GL_GetProcAddress("glHint");
-	PROC_CAST glLineWidth = SDL_GL_GetProcAddress("glLineWidth");
-	PROC_CAST glPointSize = SDL_GL_GetProcAddress("glPointSize");
-	PROC_CAST glPolygonMode = SDL_GL_GetProcAddress("glPolygonMode");
-	PROC_CAST glScissor = SDL_GL_GetProcAddress("glScissor");
-	PROC_CAST glTexParameterf = SDL_GL_GetProcAddress("glTexParameterf");
-	PROC_CAST glTexParameterfv = SDL_GL_GetProcAddress("glTexParameterfv");
-	PROC_CAST glTexParameteri = SDL_GL_GetProcAddress("glTexParameteri");
-	PROC_CAST glTexParameteriv = SDL_GL_GetProcAddress("glTexParameteriv");
-	PROC_CAST glTexImage1D = SDL_GL_GetProcAddress("glTexImage1D");
-	PROC_CAST glTexImage2D = SDL_GL_GetProcAddress("glTexImage2D");
-	PROC_CAST glDrawBuffer = SDL_GL_GetProcAddress("glDrawBuffer");
-	PROC_CAST glClear = SDL_GL_GetProcAddress("glClear");
-	PROC_CAST glClearColor = SDL_GL_GetProcAddress("glClearColor");
-	PROC_CAST glClearStencil = SDL_GL_GetProcAddress("glClearStencil");
-	PROC_CAST glClearDepth = SDL_GL_GetProcAddress("glClearDepth");
-	PROC_CAST glStencilMask = SDL_GL_GetProcAddress("glStencilMask");
-	PROC_CAST glColorMask = SDL_GL_GetProcAddress("glColorMask");
-	PROC_CAST glDepthMask = SDL_GL_GetProcAddress("glDepthMask");
-	PROC_CAST glDisable = SDL_GL_GetProcAddress("glDisable");
-	PROC_CAST glEnable = SDL_GL_GetProcAddress("glEnable");
-	PROC_CAST glFinish = SDL_GL_GetProcAddress("glFinish");
-	PROC_CAST glFlush = SDL_GL_GetProcAddress("glFlush");
-	PROC_CAST glBlendFunc = SDL_GL_GetProcAddress("glBlendFunc");
-	PROC_CAST glLogicOp = SDL_GL_GetProcAddress("glLogicOp");
-	PROC_CAST glStencilFunc = SDL_GL_GetProcAddress("glStencilFunc");
-	PROC_CAST glStencilOp = SDL_GL_GetProcAddress("glStencilOp");
-	PROC_CAST glDepthFunc = SDL_GL_GetProcAddress("glDepthFunc");
-	PROC_CAST glPixelStoref = SDL_GL_GetProcAddress("glPixelStoref");
-	PROC_CAST glPixelStorei = SDL_GL_GetProcAddress("glPixelStorei");
-	PROC_CAST glReadBuffer = SDL_GL_GetProcAddress("glReadBuffer");
-	PROC_CAST glReadPixels = SDL_GL_GetProcAddress("glReadPixels");
-	PROC_CAST glGetBooleanv = SDL_GL_GetProcAddress("glGetBooleanv");
-	PROC_CAST glGetDoublev = SDL_GL_GetProcAddress("glGetDoublev");
-	PROC_CAST glGetError = SDL_GL_GetProcAddress("glGetError");
-	PROC_CAST glGetFloatv = SDL_GL_GetProcAddress("glGetFloatv");
-	PROC_CAST glGetIntegerv = SDL_GL_GetProcAddress("glGetIntegerv");
-	PROC_CAST glGetString = SDL_GL_GetProcAddress("glGetString");
-	PROC_CAST glGetTexImage = SDL_GL_GetProcAddress("glGetTexImage");
-	PROC_CAST glGetTexParameterfv = SDL_GL_GetProcAddress("glGetTexParameterfv");
-	PROC_CAST glGetTexParameteriv = SDL_GL_GetProcAddress("glGetTexParameteriv");
-	PROC_CAST glGetTexLevelParameterfv = SDL_GL_GetProcAddress("glGetTexLevelParameterfv");
-	PROC_CAST glGetTexLevelParameteriv = SDL_GL_GetProcAddress("glGetTexLevelParameteriv");
-	PROC_CAST glIsEnabled = SDL_GL_GetProcAddress("glIsEnabled");
-	PROC_CAST glDepthRange = SDL_GL_GetProcAddress("glDepthRange");
-	PROC_CAST glViewport = SDL_GL_GetProcAddress("glViewport");
-	PROC_CAST glDrawArrays = SDL_GL_GetProcAddress("glDrawArrays");
-	PROC_CAST glDrawElements = SDL_GL_GetProcAddress("glDrawElements");
-	PROC_CAST glGetPointerv = SDL_GL_GetProcAddress("glGetPointerv");
-	PROC_CAST glPolygonOffset = SDL_GL_GetProcAddress("glPolygonOffset");
-	PROC_CAST glCopyTexImage1D = SDL_GL_GetProcAddress("glCopyTexImage1D");
-	PROC_CAST glCopyTexImage2D = SDL_GL_GetProcAddress("glCopyTexImage2D");
-	PROC_CAST glCopyTexSubImage1D = SDL_GL_GetProcAddress("glCopyTexSubImage1D");
-	PROC_CAST glCopyTexSubImage2D = SDL_GL_GetProcAddress("glCopyTexSubImage2D");
-	PROC_CAST glTexSubImage1D = SDL_GL_GetProcAddress("glTexSubImage1D");
-	PROC_CAST glTexSubImage2D = SDL_GL_GetProcAddress("glTexSubImage2D");
-	PROC_CAST glBindTexture = SDL_GL_GetProcAddress("glBindTexture");
-	PROC_CAST glDeleteTextures = SDL_GL_GetProcAddress("glDeleteTextures");
-	PROC_CAST glGenTextures = SDL_GL_GetProcAddress("glGenTextures");
-	PROC_CAST glIsTexture = SDL_GL_GetProcAddress("glIsTexture");
-	PROC_CAST glDrawRangeElements = SDL_GL_GetProcAddress("glDrawRangeElements");
-	PROC_CAST glTexImage3D = SDL_GL_GetProcAddress("glTexImage3D");
-	PROC_CAST glTexSubImage3D = SDL_GL_GetProcAddress("glTexSubImage3D");
-	PROC_CAST glCopyTexSubImage3D = SDL_GL_GetProcAddress("glCopyTexSubImage3D");
-	PROC_CAST glActiveTexture = SDL_GL_GetProcAddress("glActiveTexture");
-	PROC_CAST glSampleCoverage = SDL_GL_GetProcAddress("glSampleCoverage");
-	PROC_CAST glCompressedTexImage3D = SDL_GL_GetProcAddress("glCompressedTexImage3D");
-	PROC_CAST glCompressedTexImage2D = SDL_GL_GetProcAddress("glCompressedTexImage2D");
-	PROC_CAST glCompressedTexImage1D = SDL_GL_GetProcAddress("glCompressedTexImage1D");
-	PROC_CAST glCompressedTexSubImage3D = SDL_GL_GetProcAddress("glCompressedTexSubImage3D");
-	PROC_CAST glCompressedTexSubImage2D = SDL_GL_GetProcAddress("glCompressedTexSubImage2D");
-	PROC_CAST glCompressedTexSubImage1D = SDL_GL_GetProcAddress("glCompressedTexSubImage1D");
-	PROC_CAST glGetCompressedTexImage = SDL_GL_GetProcAddress("glGetCompressedTexImage");
-	PROC_CAST glBlendFuncSeparate = SDL_GL_GetProcAddress("glBlendFuncSeparate");
-	PROC_CAST glMultiDrawArrays = SDL_GL_GetProcAddress("glMultiDrawArrays");
-	PROC_CAST glMultiDrawElements = SDL_GL_GetProcAddress("glMultiDrawElements");
-	PROC_CAST glPointParameterf = SDL_GL_GetProcAddress("glPointParameterf");
-	PROC_CAST glPointParameterfv = SDL_GL_GetProcAddress("glPointParameterfv");
-	PROC_CAST glPointParameteri = SDL_GL_GetProcAddress("glPointParameteri");
-	PROC_CAST glPointParameteriv = SDL_GL_GetProcAddress("glPointParameteriv");
-	PROC_CAST glBlendColor = SDL_GL_GetProcAddress("glBlendColor");
-	PROC_CAST glBlendEquation = SDL_GL_GetProcAddress("glBlendEquation");
-	PROC_CAST glGenQueries = SDL_GL_GetProcAddress("glGenQueries");
-	PROC_CAST glDeleteQueries = SDL_GL_GetProcAddress("glDeleteQueries");
-	PROC_CAST glIsQuery = SDL_GL_GetProcAddress("glIsQuery");
-	PROC_CAST glBeginQuery = SDL_GL_GetProcAddress("glBeginQuery");
-	PROC_CAST glEndQuery = SDL_GL_GetProcAddress("glEndQuery");
-	PROC_CAST glGetQueryiv = SDL_GL_GetProcAddress("glGetQueryiv");
-	PROC_CAST glGetQueryObjectiv = SDL_GL_GetProcAddress("glGetQueryObjectiv");
-	PROC_CAST glGetQueryObjectuiv = SDL_GL_GetProcAddress("glGetQueryObjectuiv");
-	PROC_CAST glBindBuffer = SDL_GL_GetProcAddress("glBindBuffer");
-	PROC_CAST glDeleteBuffers = SDL_GL_GetProcAddress("glDeleteBuffers");
-	PROC_CAST glGenBuffers = SDL_GL_GetProcAddress("glGenBuffers");
-	PROC_CAST glIsBuffer = SDL_GL_GetProcAddress("glIsBuffer");
-	PROC_CAST glBufferData = SDL_GL_GetProcAddress("glBufferData");
-	PROC_CAST glBufferSubData = SDL_GL_GetProcAddress("glBufferSubData");
-	PROC_CAST glGetBufferSubData = SDL_GL_GetProcAddress("glGetBufferSubData");
-	PROC_CAST glMapBuffer = SDL_GL_GetProcAddress("glMapBuffer");
-	PROC_CAST glUnmapBuffer = SDL_GL_GetProcAddress("glUnmapBuffer");
-	PROC_CAST glGetBufferParameteriv = SDL_GL_GetProcAddress("glGetBufferParameteriv");
-	PROC_CAST glGetBufferPointerv = SDL_GL_GetProcAddress("glGetBufferPointerv");
-	PROC_CAST glBlendEquationSeparate = SDL_GL_GetProcAddress("glBlendEquationSeparate");
-	PROC_CAST glDrawBuffers = SDL_GL_GetProcAddress("glDrawBuffers");
-	PROC_CAST glStencilOpSeparate = SDL_GL_GetProcAddress("glStencilOpSeparate");
-	PROC_CAST glStencilFuncSeparate = SDL_GL_GetProcAddress("glStencilFuncSeparate");
-	PROC_CAST glStencilMaskSeparate = SDL_GL_GetProcAddress("glStencilMaskSeparate");
-	PROC_CAST glAttachShader = SDL_GL_GetProcAddress("glAttachShader");
-	PROC_CAST glBindAttribLocation = SDL_GL_GetProcAddress("glBindAttribLocation");
-	PROC_CAST glCompileShader = SDL_GL_GetProcAddress("glCompileShader");
-	PROC_CAST glCreateProgram = SDL_GL_GetProcAddress("glCreateProgram");
-	PROC_CAST glCreateShader = SDL_GL_GetProcAddress("glCreateShader");
-	PROC_CAST glDeleteProgram = SDL_GL_GetProcAddress("glDeleteProgram");
-	PROC_CAST glDeleteShader = SDL_GL_GetProcAddress("glDeleteShader");
-	PROC_CAST glDetachShader = SDL_GL_GetProcAddress("glDetachShader");
-	PROC_CAST glDisableVertexAttribArray = SDL_GL_GetProcAddress("glDisableVertexAttribArray");
-	PROC_CAST glEnableVertexAttribArray = SDL_GL_GetProcAddress("glEnableVertexAttribArray");
-	PROC_CAST glGetActiveAttrib = SDL_GL_GetProcAddress("glGetActiveAttrib");
-	PROC_CAST glGetActiveUniform = SDL_GL_GetProcAddress("glGetActiveUniform");
-	PROC_CAST glGetAttachedShaders = SDL_GL_GetProcAddress("glGetAttachedShaders");
-	PROC_CAST glGetAttribLocation = SDL_GL_GetProcAddress("glGetAttribLocation");
-	PROC_CAST glGetProgramiv = SDL_GL_GetProcAddress("glGetProgramiv");
-	PROC_CAST glGetProgramInfoLog = SDL_GL_GetProcAddress("glGetProgramInfoLog");
-	PROC_CAST glGetShaderiv = SDL_GL_GetProcAddress("glGetShaderiv");
-	PROC_CAST glGetShaderInfoLog = SDL_GL_GetProcAddress("glGetShaderInfoLog");
-	PROC_CAST glGetShaderSource = SDL_GL_GetProcAddress("glGetShaderSource");
-	PROC_CAST glGetUniformLocation = SDL_GL_GetProcAddress("glGetUniformLocation");
-	PROC_CAST glGetUniformfv = SDL_GL_GetProcAddress("glGetUniformfv");
-	PROC_CAST glGetUniformiv = SDL_GL_GetProcAddress("glGetUniformiv");
-	PROC_CAST glGetVertexAttribdv = SDL_GL_GetProcAddress("glGetVertexAttribdv");
-	PROC_CAST glGetVertexAttribfv = SDL_GL_GetProcAddress("glGetVertexAttribfv");
-	PROC_CAST glGetVertexAttribiv = SDL_GL_GetProcAddress("glGetVertexAttribiv");
-	PROC_CAST glGetVertexAttribPointerv = SDL_GL_GetProcAddress("glGetVertexAttribPointerv");
-	PROC_CAST glIsProgram = SDL_GL_GetProcAddress("glIsProgram");
-	PROC_CAST glIsShader = SDL_GL_GetProcAddress("glIsShader");
-	PROC_CAST glLinkProgram = SDL_GL_GetProcAddress("glLinkProgram");
-	PROC_CAST glShaderSource = SDL_GL_GetProcAddress("glShaderSource");
-	PROC_CAST glUseProgram = SDL_GL_GetProcAddress("glUseProgram");
-	PROC_CAST glUniform1f = SDL_GL_GetProcAddress("glUniform1f");
-	PROC_CAST glUniform2f = SDL_GL_GetProcAddress("glUniform2f");
-	PROC_CAST glUniform3f = SDL_GL_GetProcAddress("glUniform3f");
-	PROC_CAST glUniform4f = SDL_GL_GetProcAddress("glUniform4f");
-	PROC_CAST glUniform1i = SDL_GL_GetProcAddress("glUniform1i");
-	PROC_CAST glUniform2i = SDL_GL_GetProcAddress("glUniform2i");
-	PROC_CAST glUniform3i = SDL_GL_GetProcAddress("glUniform3i");
-	PROC_CAST glUniform4i = SDL_GL_GetProcAddress("glUniform4i");
-	PROC_CAST glUniform1fv = SDL_GL_GetProcAddress("glUniform1fv");
-	PROC_CAST glUniform2fv = SDL_GL_GetProcAddress("glUniform2fv");
-	PROC_CAST glUniform3fv = SDL_GL_GetProcAddress("glUniform3fv");
-	PROC_CAST glUniform4fv = SDL_GL_GetProcAddress("glUniform4fv");
-	PROC_CAST glUniform1iv = SDL_GL_GetProcAddress("glUniform1iv");
-	PROC_CAST glUniform2iv = SDL_GL_GetProcAddress("glUniform2iv");
-	PROC_CAST glUniform3iv = SDL_GL_GetProcAddress("glUniform3iv");
-	PROC_CAST glUniform4iv = SDL_GL_GetProcAddress("glUniform4iv");
-	PROC_CAST glUniformMatrix2fv = SDL_GL_GetProcAddress("glUniformMatrix2fv");
-	PROC_CAST glUniformMatrix3fv = SDL_GL_GetProcAddress("glUniformMatrix3fv");
-	PROC_CAST glUniformMatrix4fv = SDL_GL_GetProcAddress("glUniformMatrix4fv");
-	PROC_CAST glValidateProgram = SDL_GL_GetProcAddress("glValidateProgram");
-	PROC_CAST glVertexAttrib1d = SDL_GL_GetProcAddress("glVertexAttrib1d");
-	PROC_CAST glVertexAttrib1dv = SDL_GL_GetProcAddress("glVertexAttrib1dv");
-	PROC_CAST glVertexAttrib1f = SDL_GL_GetProcAddress("glVertexAttrib1f");
-	PROC_CAST glVertexAttrib1fv = SDL_GL_GetProcAddress("glVertexAttrib1fv");
-	PROC_CAST glVertexAttrib1s = SDL_GL_GetProcAddress("glVertexAttrib1s");
-	PROC_CAST glVertexAttrib1sv = SDL_GL_GetProcAddress("glVertexAttrib1sv");
-	PROC_CAST glVertexAttrib2d = SDL_GL_GetProcAddress("glVertexAttrib2d");
-	PROC_CAST glVertexAttrib2dv = SDL_GL_GetProcAddress("glVertexAttrib2dv");
-	PROC_CAST glVertexAttrib2f = SDL_GL_GetProcAddress("glVertexAttrib2f");
-	PROC_CAST glVertexAttrib2fv = SDL_GL_GetProcAddress("glVertexAttrib2fv");
-	PROC_CAST glVertexAttrib2s = SDL_GL_GetProcAddress("glVertexAttrib2s");
-	PROC_CAST glVertexAttrib2sv = SDL_GL_GetProcAddress("glVertexAttrib2sv");
-	PROC_CAST glVertexAttrib3d = SDL_GL_GetProcAddress("glVertexAttrib3d");
-	PROC_CAST glVertexAttrib3dv = SDL_GL_GetProcAddress("glVertexAttrib3dv");
-	PROC_CAST glVertexAttrib3f = SDL_GL_GetProcAddress("glVertexAttrib3f");
-	PROC_CAST glVertexAttrib3fv = SDL_GL_GetProcAddress("glVertexAttrib3fv");
-	PROC_CAST glVertexAttrib3s = SDL_GL_GetProcAddress("glVertexAttrib3s");
-	PROC_CAST glVertexAttrib3sv = SDL_GL_GetProcAddress("glVertexAttrib3sv");
-	PROC_CAST glVertexAttrib4Nbv = SDL_GL_GetProcAddress("glVertexAttrib4Nbv");
-	PROC_CAST glVertexAttrib4Niv = SDL_GL_GetProcAddress("glVertexAttrib4Niv");
-	PROC_CAST glVertexAttrib4Nsv = SDL_GL_GetProcAddress("glVertexAttrib4Nsv");
-	PROC_CAST glVertexAttrib4Nub = SDL_GL_GetProcAddress("glVertexAttrib4Nub");
-	PROC_CAST glVertexAttrib4Nubv = SDL_GL_GetProcAddress("glVertexAttrib4Nubv");
-	PROC_CAST glVertexAttrib4Nuiv = SDL_GL_GetProcAddress("glVertexAttrib4Nuiv");
-	PROC_CAST glVertexAttrib4Nusv = SDL_GL_GetProcAddress("glVertexAttrib4Nusv");
-	PROC_CAST glVertexAttrib4bv = SDL_GL_GetProcAddress("glVertexAttrib4bv");
-	PROC_CAST glVertexAttrib4d = SDL_GL_GetProcAddress("glVertexAttrib4d");
-	PROC_CAST glVertexAttrib4dv = SDL_GL_GetProcAddress("glVertexAttrib4dv");
-	PROC_CAST glVertexAttrib4f = SDL_GL_GetProcAddress("glVertexAttrib4f");
-	PROC_CAST glVertexAttrib4fv = SDL_GL_GetProcAddress("glVertexAttrib4fv");
-	PROC_CAST glVertexAttrib4iv = SDL_GL_GetProcAddress("glVertexAttrib4iv");
-	PROC_CAST glVertexAttrib4s = SDL_GL_GetProcAddress("glVertexAttrib4s");
-	PROC_CAST glVertexAttrib4sv = SDL_GL_GetProcAddress("glVertexAttrib4sv");
-	PROC_CAST glVertexAttrib4ubv = SDL_GL_GetProcAddress("glVertexAttrib4ubv");
-	PROC_CAST glVertexAttrib4uiv = SDL_GL_GetProcAddress("glVertexAttrib4uiv");
-	PROC_CAST glVertexAttrib4usv = SDL_GL_GetProcAddress("glVertexAttrib4usv");
-	PROC_CAST glVertexAttribPointer = SDL_GL_GetProcAddress("glVertexAttribPointer");
-	PROC_CAST glUniformMatrix2x3fv = SDL_GL_GetProcAddress("glUniformMatrix2x3fv");
-	PROC_CAST glUniformMatrix3x2fv = SDL_GL_GetProcAddress("glUniformMatrix3x2fv");
-	PROC_CAST glUniformMatrix2x4fv = SDL_GL_GetProcAddress("glUniformMatrix2x4fv");
-	PROC_CAST glUniformMatrix4x2fv = SDL_GL_GetProcAddress("glUniformMatrix4x2fv");
-	PROC_CAST glUniformMatrix3x4fv = SDL_GL_GetProcAddress("glUniformMatrix3x4fv");
-	PROC_CAST glUniformMatrix4x3fv = SDL_GL_GetProcAddress("glUniformMatrix4x3fv");
-	PROC_CAST glColorMaski = SDL_GL_GetProcAddress("glColorMaski");
-	PROC_CAST glGetBooleani_v = SDL_GL_GetProcAddress("glGetBooleani_v");
-	PROC_CAST glGetIntegeri_v = SDL_GL_GetProcAddress("glGetIntegeri_v");
-	PROC_CAST glEnablei = SDL_GL_GetProcAddress("glEnablei");
-	PROC_CAST glDisablei = SDL_GL_GetProcAddress("glDisablei");
-	PROC_CAST glIsEnabledi = SDL_GL_GetProcAddress("glIsEnabledi");
-	PROC_CAST glBeginTransformFeedback = SDL_GL_GetProcAddress("glBeginTransformFeedback");
-	PROC_CAST glEndTransformFeedback = SDL_GL_GetProcAddress("glEndTransformFeedback");
-	PROC_CAST glBindBufferRange = SDL_GL_GetProcAddress("glBindBufferRange");
-	PROC_CAST glBindBufferBase = SDL_GL_GetProcAddress("glBindBufferBase");
-	PROC_CAST glTransformFeedbackVaryings = SDL_GL_GetProcAddress("glTransformFeedbackVaryings");
-	PROC_CAST glGetTransformFeedbackVarying = SDL_GL_GetProcAddress("glGetTransformFeedbackVarying");
-	PROC_CAST glClampColor = SDL_GL_GetProcAddress("glClampColor");
-	PROC_CAST glBeginConditionalRender = SDL_GL_GetProcAddress("glBeginConditionalRender");
-	PROC_CAST glEndConditionalRender = SDL_GL_GetProcAddress("glEndConditionalRender");
-	PROC_CAST glVertexAttribIPointer = SDL_GL_GetProcAddress("glVertexAttribIPointer");
-	PROC_CAST glGetVertexAttribIiv = SDL_GL_GetProcAddress("glGetVertexAttribIiv");
-	PROC_CAST glGetVertexAttribIuiv = SDL_GL_GetProcAddress("glGetVertexAttribIuiv");
-	PROC_CAST glVertexAttribI1i = SDL_GL_GetProcAddress("glVertexAttribI1i");
-	PROC_CAST glVertexAttribI2i = SDL_GL_GetProcAddress("glVertexAttribI2i");
-	PROC_CAST glVertexAttribI3i = SDL_GL_GetProcAddress("glVertexAttribI3i");
-	PROC_CAST glVertexAttribI4i = SDL_GL_GetProcAddress("glVertexAttribI4i");
-	PROC_CAST glVertexAttribI1ui = SDL_GL_GetProcAddress("glVertexAttribI1ui");
-	PROC_CAST glVertexAttribI2ui = SDL_GL_GetProcAddress("glVertexAttribI2ui");
-	PROC_CAST glVertexAttribI3ui = SDL_GL_GetProcAddress("glVertexAttribI3ui");
-	PROC_CAST glVertexAttribI4ui = SDL_GL_GetProcAddress("glVertexAttribI4ui");
-	PROC_CAST glVertexAttribI1iv = SDL_GL_GetProcAddress("glVertexAttribI1iv");
-	PROC_CAST glVertexAttribI2iv = SDL_GL_GetProcAddress("glVertexAttribI2iv");
-	PROC_CAST glVertexAttribI3iv = SDL_GL_GetProcAddress("glVertexAttribI3iv");
-	PROC_CAST glVertexAttribI4iv = SDL_GL_GetProcAddress("glVertexAttribI4iv");
-	PROC_CAST glVertexAttribI1uiv = SDL_GL_GetProcAddress("glVertexAttribI1uiv");
-	PROC_CAST glVertexAttribI2uiv = SDL_GL_GetProcAddress("glVertexAttribI2uiv");
-	PROC_CAST glVertexAttribI3uiv = SDL_GL_GetProcAddress("glVertexAttribI3uiv");
-	PROC_CAST glVertexAttribI4uiv = SDL_GL_GetProcAddress("glVertexAttribI4uiv");
-	PROC_CAST glVertexAttribI4bv = SDL_GL_GetProcAddress("glVertexAttribI4bv");
-	PROC_CAST glVertexAttribI4sv = SDL_GL_GetProcAddress("glVertexAttribI4sv");
-	PROC_CAST glVertexAttribI4ubv = SDL_GL_GetProcAddress("glVertexAttribI4ubv");
-	PROC_CAST glVertexAttribI4usv = SDL_GL_GetProcAddress("glVertexAttribI4usv");
-	PROC_CAST glGetUniformuiv = SDL_GL_GetProcAddress("glGetUniformuiv");
-	PROC_CAST glBindFragDataLocation = SDL_GL_GetProcAddress("glBindFragDataLocation");
-	PROC_CAST glGetFragDataLocation = SDL_GL_GetProcAddress("glGetFragDataLocation");
-	PROC_CAST glUniform1ui = SDL_GL_GetProcAddress("glUniform1ui");
-	PROC_CAST glUniform2ui = SDL_GL_GetProcAddress("glUniform2ui");
-	PROC_CAST glUniform3ui = SDL_GL_GetProcAddress("glUniform3ui");
-	PROC_CAST glUniform4ui = SDL_GL_GetProcAddress("glUniform4ui");
-	PROC_CAST glUniform1uiv = SDL_GL_GetProcAddress("glUniform1uiv");
-	PROC_CAST glUniform2uiv = SDL_GL_GetProcAddress("glUniform2uiv");
-	PROC_CAST glUniform3uiv = SDL_GL_GetProcAddress("glUniform3uiv");
-	PROC_CAST glUniform4uiv = SDL_GL_GetProcAddress("glUniform4uiv");
-	PROC_CAST glTexParameterIiv = SDL_GL_GetProcAddress("glTexParameterIiv");
-	PROC_CAST glTexParameterIuiv = SDL_GL_GetProcAddress("glTexParameterIuiv");
-	PROC_CAST glGetTexParameterIiv = SDL_GL_GetProcAddress("glGetTexParameterIiv");
-	PROC_CAST glGetTexParameterIuiv = SDL_GL_GetProcAddress("glGetTexParameterIuiv");
-	PROC_CAST glClearBufferiv = SDL_GL_GetProcAddress("glClearBufferiv");
-	PROC_CAST glClearBufferuiv = SDL_GL_GetProcAddress("glClearBufferuiv");
-	PROC_CAST glClearBufferfv = SDL_GL_GetProcAddress("glClearBufferfv");
-	PROC_CAST glClearBufferfi = SDL_GL_GetProcAddress("glClearBufferfi");
-	PROC_CAST glGetStringi = SDL_GL_GetProcAddress("glGetStringi");
-	PROC_CAST glIsRenderbuffer = SDL_GL_GetProcAddress("glIsRenderbuffer");
-	PROC_CAST glBindRenderbuffer = SDL_GL_GetProcAddress("glBindRenderbuffer");
-	PROC_CAST glDeleteRenderbuffers = SDL_GL_GetProcAddress("glDeleteRenderbuffers");
-	PROC_CAST glGenRenderbuffers = SDL_GL_GetProcAddress("glGenRenderbuffers");
-	PROC_CAST glRenderbufferStorage = SDL_GL_GetProcAddress("glRenderbufferStorage");
-	PROC_CAST glGetRenderbufferParameteriv = SDL_GL_GetProcAddress("glGetRenderbufferParameteriv");
-	PROC_CAST glIsFramebuffer = SDL_GL_GetProcAddress("glIsFramebuffer");
-	PROC_CAST glBindFramebuffer = SDL_GL_GetProcAddress("glBindFramebuffer");
-	PROC_CAST glDeleteFramebuffers = SDL_GL_GetProcAddress("glDeleteFramebuffers");
-	PROC_CAST glGenFramebuffers = SDL_GL_GetProcAddress("glGenFramebuffers");
-	PROC_CAST glCheckFramebufferStatus = SDL_GL_GetProcAddress("glCheckFramebufferStatus");
-	PROC_CAST glFramebufferTexture1D = SDL_GL_GetProcAddress("glFramebufferTexture1D");
-	PROC_CAST glFramebufferTexture2D = SDL_GL_GetProcAddress("glFramebufferTexture2D");
-	PROC_CAST glFramebufferTexture3D = SDL_GL_GetProcAddress("glFramebufferTexture3D");
-	PROC_CAST glFramebufferRenderbuffer = SDL_GL_GetProcAddress("glFramebufferRenderbuffer");
-	PROC_CAST glGetFramebufferAttachmentParameteriv = SDL_GL_GetProcAddress("glGetFramebufferAttachmentParameteriv");
-	PROC_CAST glGenerateMipmap = SDL_GL_GetProcAddress("glGenerateMipmap");
-	PROC_CAST glBlitFramebuffer = SDL_GL_GetProcAddress("glBlitFramebuffer");
-	PROC_CAST glRenderbufferStorageMultisample = SDL_GL_GetProcAddress("glRenderbufferStorageMultisample");
-	PROC_CAST glFramebufferTextureLayer = SDL_GL_GetProcAddress("glFramebufferTextureLayer");
-	PROC_CAST glMapBufferRange = SDL_GL_GetProcAddress("glMapBufferRange");
-	PROC_CAST glFlushMappedBufferRange = SDL_GL_GetProcAddress("glFlushMappedBufferRange");
-	PROC_CAST glBindVertexArray = SDL_GL_GetProcAddress("glBindVertexArray");
-	PROC_CAST glDeleteVertexArrays = SDL_GL_GetProcAddress("glDeleteVertexArrays");
-	PROC_CAST glGenVertexArrays = SDL_GL_GetProcAddress("glGenVertexArrays");
-	PROC_CAST glIsVertexArray = SDL_GL_GetProcAddress("glIsVertexArray");
-	PROC_CAST glDrawArraysInstanced = SDL_GL_GetProcAddress("glDrawArraysInstanced");
-	PROC_CAST glDrawElementsInstanced = SDL_GL_GetProcAddress("glDrawElementsInstanced");
-	PROC_CAST glTexBuffer = SDL_GL_GetProcAddress("glTexBuffer");
-	PROC_CAST glPrimitiveRestartIndex = SDL_GL_GetProcAddress("glPrimitiveRestartIndex");
-	PROC_CAST glCopyBufferSubData = SDL_GL_GetProcAddress("glCopyBufferSubData");
-	PROC_CAST glGetUniformIndices = SDL_GL_GetProcAddress("glGetUniformIndices");
-	PROC_CAST glGetActiveUniformsiv = SDL_GL_GetProcAddress("glGetActiveUniformsiv");
-	PROC_CAST glGetActiveUniformName = SDL_GL_GetProcAddress("glGetActiveUniformName");
-	PROC_CAST glGetUniformBlockIndex = SDL_GL_GetProcAddress("glGetUniformBlockIndex");
-	PROC_CAST glGetActiveUniformBlockiv = SDL_GL_GetProcAddress("glGetActiveUniformBlockiv");
-	PROC_CAST glGetActiveUniformBlockName = SDL_GL_GetProcAddress("glGetActiveUniformBlockName");
-	PROC_CAST glUniformBlockBinding = SDL_GL_GetProcAddress("glUniformBlockBinding");
-	PROC_CAST glDrawElementsBaseVertex = SDL_GL_GetProcAddress("glDrawElementsBaseVertex");
-	PROC_CAST glDrawRangeElementsBaseVertex = SDL_GL_GetProcAddress("glDrawRangeElementsBaseVertex");
-	PROC_CAST glDrawElementsInstancedBaseVertex = SDL_GL_GetProcAddress("glDrawElementsInstancedBaseVertex");
-	PROC_CAST glMultiDrawElementsBaseVertex = SDL_GL_GetProcAddress("glMultiDrawElementsBaseVertex");
-	PROC_CAST glProvokingVertex = SDL_GL_GetProcAddress("glProvokingVertex");
-	PROC_CAST glFenceSync = SDL_GL_GetProcAddress("glFenceSync");
-	PROC_CAST glIsSync = SDL_GL_GetProcAddress("glIsSync");
-	PROC_CAST glDeleteSync = SDL_GL_GetProcAddress("glDeleteSync");
-	PROC_CAST glClientWaitSync = SDL_GL_GetProcAddress("glClientWaitSync");
-	PROC_CAST glWaitSync = SDL_GL_GetProcAddress("glWaitSync");
-	PROC_CAST glGetInteger64v = SDL_GL_GetProcAddress("glGetInteger64v");
-	PROC_CAST glGetSynciv = SDL_GL_GetProcAddress("glGetSynciv");
-	PROC_CAST glGetInteger64i_v = SDL_GL_GetProcAddress("glGetInteger64i_v");
-	PROC_CAST glGetBufferParameteri64v = SDL_GL_GetProcAddress("glGetBufferParameteri64v");
-	PROC_CAST glFramebufferTexture = SDL_GL_GetProcAddress("glFramebufferTexture");
-	PROC_CAST glTexImage2DMultisample = SDL_GL_GetProcAddress("glTexImage2DMultisample");
-	PROC_CAST glTexImage3DMultisample = SDL_GL_GetProcAddress("glTexImage3DMultisample");
-	PROC_CAST glGetMultisamplefv = SDL_GL_GetProcAddress("glGetMultisamplefv");
-	PROC_CAST glSampleMaski = SDL_GL_GetProcAddress("glSampleMaski");
-	PROC_CAST glBindFragDataLocationIndexed = SDL_GL_GetProcAddress("glBindFragDataLocationIndexed");
-	PROC_CAST glGetFragDataIndex = SDL_GL_GetProcAddress("glGetFragDataIndex");
-	PROC_CAST glGenSamplers = SDL_GL_GetProcAddress("glGenSamplers");
-	PROC_CAST glDeleteSamplers = SDL_GL_GetProcAddress("glDeleteSamplers");
-	PROC_CAST glIsSampler = SDL_GL_GetProcAddress("glIsSampler");
-	PROC_CAST glBindSampler = SDL_GL_GetProcAddress("glBindSampler");
-	PROC_CAST glSamplerParameteri = SDL_GL_GetProcAddress("glSamplerParameteri");
-	PROC_CAST glSamplerParameteriv = SDL_GL_GetProcAddress("glSamplerParameteriv");
-	PROC_CAST glSamplerParameterf = SDL_GL_GetProcAddress("glSamplerParameterf");
-	PROC_CAST glSamplerParameterfv = SDL_GL_GetProcAddress("glSamplerParameterfv");
-	PROC_CAST glSamplerParameterIiv = SDL_GL_GetProcAddress("glSamplerParameterIiv");
-	PROC_CAST glSamplerParameterIuiv = SDL_GL_GetProcAddress("glSamplerParameterIuiv");
-	PROC_CAST glGetSamplerParameteriv = SDL_GL_GetProcAddress("glGetSamplerParameteriv");
-	PROC_CAST glGetSamplerParameterIiv = SDL_GL_GetProcAddress("glGetSamplerParameterIiv");
-	PROC_CAST glGetSamplerParameterfv = SDL_GL_GetProcAddress("glGetSamplerParameterfv");
-	PROC_CAST glGetSamplerParameterIuiv = SDL_GL_GetProcAddress("glGetSamplerParameterIuiv");
-	PROC_CAST glQueryCounter = SDL_GL_GetProcAddress("glQueryCounter");
-	PROC_CAST glGetQueryObjecti64v = SDL_GL_GetProcAddress("glGetQueryObjecti64v");
-	PROC_CAST glGetQueryObjectui64v = SDL_GL_GetProcAddress("glGetQueryObjectui64v");
-	PROC_CAST glVertexAttribDivisor = SDL_GL_GetProcAddress("glVertexAttribDivisor");
-	PROC_CAST glVertexAttribP1ui = SDL_GL_GetProcAddress("glVertexAttribP1ui");
-	PROC_CAST glVertexAttribP1uiv = SDL_GL_GetProcAddress("glVertexAttribP1uiv");
-	PROC_CAST glVertexAttribP2ui = SDL_GL_GetProcAddress("glVertexAttribP2ui");
-	PROC_CAST glVertexAttribP2uiv = SDL_GL_GetProcAddress("glVertexAttribP2uiv");
-	PROC_CAST glVertexAttribP3ui = SDL_GL_GetProcAddress("glVertexAttribP3ui");
-	PROC_CAST glVertexAttribP3uiv = SDL_GL_GetProcAddress("glVertexAttribP3uiv");
-	PROC_CAST glVertexAttribP4ui = SDL_GL_GetProcAddress("glVertexAttribP4ui");
-	PROC_CAST glVertexAttribP4uiv = SDL_GL_GetProcAddress("glVertexAttribP4uiv");
-	PROC_CAST glMinSampleShading = SDL_GL_GetProcAddress("glMinSampleShading");
-	PROC_CAST glBlendEquationi = SDL_GL_GetProcAddress("glBlendEquationi");
-	PROC_CAST glBlendEquationSeparatei = SDL_GL_GetProcAddress("glBlendEquationSeparatei");
-	PROC_CAST glBlendFunci = SDL_GL_GetProcAddress("glBlendFunci");
-	PROC_CAST glBlendFuncSeparatei = SDL_GL_GetProcAddress("glBlendFuncSeparatei");
-	PROC_CAST glDrawArraysIndirect = SDL_GL_GetProcAddress("glDrawArraysIndirect");
-	PROC_CAST glDrawElementsIndirect = SDL_GL_GetProcAddress("glDrawElementsIndirect");
-	PROC_CAST glUniform1d = SDL_GL_GetProcAddress("glUniform1d");
-	PROC_CAST glUniform2d = SDL_GL_GetProcAddress("glUniform2d");
-	PROC_CAST glUniform3d = SDL_GL_GetProcAddress("glUniform3d");
-	PROC_CAST glUniform4d = SDL_GL_GetProcAddress("glUniform4d");
-	PROC_CAST glUniform1dv = SDL_GL_GetProcAddress("glUniform1dv");
-	PROC_CAST glUniform2dv = SDL_GL_GetProcAddress("glUniform2dv");
-	PROC_CAST glUniform3dv = SDL_GL_GetProcAddress("glUniform3dv");
-	PROC_CAST glUniform4dv = SDL_GL_GetProcAddress("glUniform4dv");
-	PROC_CAST glUniformMatrix2dv = SDL_GL_GetProcAddress("glUniformMatrix2dv");
-	PROC_CAST glUniformMatrix3dv = SDL_GL_GetProcAddress("glUniformMatrix3dv");
-	PROC_CAST glUniformMatrix4dv = SDL_GL_GetProcAddress("glUniformMatrix4dv");
-	PROC_CAST glUniformMatrix2x3dv = SDL_GL_GetProcAddress("glUniformMatrix2x3dv");
-	PROC_CAST glUniformMatrix2x4dv = SDL_GL_GetProcAddress("glUniformMatrix2x4dv");
-	PROC_CAST glUniformMatrix3x2dv = SDL_GL_GetProcAddress("glUniformMatrix3x2dv");
-	PROC_CAST glUniformMatrix3x4dv = SDL_GL_GetProcAddress("glUniformMatrix3x4dv");
-	PROC_CAST glUniformMatrix4x2dv = SDL_GL_GetProcAddress("glUniformMatrix4x2dv");
-	PROC_CAST glUniformMatrix4x3dv = SDL_GL_GetProcAddress("glUniformMatrix4x3dv");
-	PROC_CAST glGetUniformdv = SDL_GL_GetProcAddress("glGetUniformdv");
-	PROC_CAST glGetSubroutineUniformLocation = SDL_GL_GetProcAddress("glGetSubroutineUniformLocation");
-	PROC_CAST glGetSubroutineIndex = SDL_GL_GetProcAddress("glGetSubroutineIndex");
-	PROC_CAST glGetActiveSubroutineUniformiv = SDL_GL_GetProcAddress("glGetActiveSubroutineUniformiv");
-	PROC_CAST glGetActiveSubroutineUniformName = SDL_GL_GetProcAddress("glGetActiveSubroutineUniformName");
-	PROC_CAST glGetActiveSubroutineName = SDL_GL_GetProcAddress("glGetActiveSubroutineName");
-	PROC_CAST glUniformSubroutinesuiv = SDL_GL_GetProcAddress("glUniformSubroutinesuiv");
-	PROC_CAST glGetUniformSubroutineuiv = SDL_GL_GetProcAddress("glGetUniformSubroutineuiv");
-	PROC_CAST glGetProgramStageiv = SDL_GL_GetProcAddress("glGetProgramStageiv");
-	PROC_CAST glPatchParameteri = SDL_GL_GetProcAddress("glPatchParameteri");
-	PROC_CAST glPatchParameterfv = SDL_GL_GetProcAddress("glPatchParameterfv");
-	PROC_CAST glBindTransformFeedback = SDL_GL_GetProcAddress("glBindTransformFeedback");
-	PROC_CAST glDeleteTransformFeedbacks = SDL_GL_GetProcAddress("glDeleteTransformFeedbacks");
-	PROC_CAST glGenTransformFeedbacks = SDL_GL_GetProcAddress("glGenTransformFeedbacks");
-	PROC_CAST glIsTransformFeedback = SDL_GL_GetProcAddress("glIsTransformFeedback");
-	PROC_CAST glPauseTransformFeedback = SDL_GL_GetProcAddress("glPauseTransformFeedback");
-	PROC_CAST glResumeTransformFeedback = SDL_GL_GetProcAddress("glResumeTransformFeedback");
-	PROC_CAST glDrawTransformFeedback = SDL_GL_GetProcAddress("glDrawTransformFeedback");
-	PROC_CAST glDrawTransformFeedbackStream = SDL_GL_GetProcAddress("glDrawTransformFeedbackStream");
-	PROC_CAST glBeginQueryIndexed = SDL_GL_GetProcAddress("glBeginQueryIndexed");
-	PROC_CAST glEndQueryIndexed = SDL_GL_GetProcAddress("glEndQueryIndexed");
-	PROC_CAST glGetQueryIndexediv = SDL_GL_GetProcAddress("glGetQueryIndexediv");
-	PROC_CAST glReleaseShaderCompiler = SDL_GL_GetProcAddress("glReleaseShaderCompiler");
-	PROC_CAST glShaderBinary = SDL_GL_GetProcAddress("glShaderBinary");
-	PROC_CAST glGetShaderPrecisionFormat = SDL_GL_GetProcAddress("glGetShaderPrecisionFormat");
-	PROC_CAST glDepthRangef = SDL_GL_GetProcAddress("glDepthRangef");
-	PROC_CAST glClearDepthf = SDL_GL_GetProcAddress("glClearDepthf");
-	PROC_CAST glGetProgramBinary = SDL_GL_GetProcAddress("glGetProgramBinary");
-	PROC_CAST glProgramBinary = SDL_GL_GetProcAddress("glProgramBinary");
-	PROC_CAST glProgramParameteri = SDL_GL_GetProcAddress("glProgramParameteri");
-	PROC_CAST glUseProgramStages = SDL_GL_GetProcAddress("glUseProgramStages");
-	PROC_CAST glActiveShaderProgram = SDL_GL_GetProcAddress("glActiveShaderProgram");
-	PROC_CAST glCreateShaderProgramv = SDL_GL_GetProcAddress("glCreateShaderProgramv");
-	PROC_CAST glBindProgramPipeline = SDL_GL_GetProcAddress("glBindProgramPipeline");
-	PROC_CAST glDeleteProgramPipelines = SDL_GL_GetProcAddress("glDeleteProgramPipelines");
-	PROC_CAST glGenProgramPipelines = SDL_GL_GetProcAddress("glGenProgramPipelines");
-	PROC_CAST glIsProgramPipeline = SDL_GL_GetProcAddress("glIsProgramPipeline");
-	PROC_CAST glGetProgramPipelineiv = SDL_GL_GetProcAddress("glGetProgramPipelineiv");
-	PROC_CAST glProgramUniform1i = SDL_GL_GetProcAddress("glProgramUniform1i");
-	PROC_CAST glProgramUniform1iv = SDL_GL_GetProcAddress("glProgramUniform1iv");
-	PROC_CAST glProgramUniform1f = SDL_GL_GetProcAddress("glProgramUniform1f");
-	PROC_CAST glProgramUniform1fv = SDL_GL_GetProcAddress("glProgramUniform1fv");
-	PROC_CAST glProgramUniform1d = SDL_GL_GetProcAddress("glProgramUniform1d");
-	PROC_CAST glProgramUniform1dv = SDL_GL_GetProcAddress("glProgramUniform1dv");
-	PROC_CAST glProgramUniform1ui = SDL_GL_GetProcAddress("glProgramUniform1ui");
-	PROC_CAST glProgramUniform1uiv = SDL_GL_GetProcAddress("glProgramUniform1uiv");
-	PROC_CAST glProgramUniform2i = SDL_GL_GetProcAddress("glProgramUniform2i");
-	PROC_CAST glProgramUniform2iv = SDL_GL_GetProcAddress("glProgramUniform2iv");
-	PROC_CAST glProgramUniform2f = SDL_GL_GetProcAddress("glProgramUniform2f");
-	PROC_CAST glProgramUniform2fv = SDL_GL_GetProcAddress("glProgramUniform2fv");
-	PROC_CAST glProgramUniform2d = SDL_GL_GetProcAddress("glProgramUniform2d");
-	PROC_CAST glProgramUniform2dv = SDL_GL_GetProcAddress("glProgramUniform2dv");
-	PROC_CAST glProgramUniform2ui = SDL_GL_GetProcAddress("glProgramUniform2ui");
-	PROC_CAST glProgramUniform2uiv = SDL_GL_GetProcAddress("glProgramUniform2uiv");
-	PROC_CAST glProgramUniform3i = SDL_GL_GetProcAddress("glProgramUniform3i");
-	PROC_CAST glProgramUniform3iv = SDL_GL_GetProcAddress("glProgramUniform3iv");
-	PROC_CAST glProgramUniform3f = SDL_GL_GetProcAddress("glProgramUniform3f");
-	PROC_CAST glProgramUniform3fv = SDL_GL_GetProcAddress("glProgramUniform3fv");
-	PROC_CAST glProgramUniform3d = SDL_GL_GetProcAddress("glProgramUniform3d");
-	PROC_CAST glProgramUniform3dv = SDL_GL_GetProcAddress("glProgramUniform3dv");
-	PROC_CAST glProgramUniform3ui = SDL_GL_GetProcAddress("glProgramUniform3ui");
-	PROC_CAST glProgramUniform3uiv = SDL_GL_GetProcAddress("glProgramUniform3uiv");
-	PROC_CAST glProgramUniform4i = SDL_GL_GetProcAddress("glProgramUniform4i");
-	PROC_CAST glProgramUniform4iv = SDL_GL_GetProcAddress("glProgramUniform4iv");
-	PROC_CAST glProgramUniform4f = SDL_GL_GetProcAddress("glProgramUniform4f");
-	PROC_CAST glProgramUniform4fv = SDL_GL_GetProcAddress("glProgramUniform4fv");
-	PROC_CAST glProgramUniform4d = SDL_GL_GetProcAddress("glProgramUniform4d");
-	PROC_CAST glProgramUniform4dv = SDL_GL_GetProcAddress("glProgramUniform4dv");
-	PROC_CAST glProgramUniform4ui = SDL_GL_GetProcAddress("glProgramUniform4ui");
-	PROC_CAST glProgramUniform4uiv = SDL_GL_GetProcAddress("glProgramUniform4uiv");
-	PROC_CAST glProgramUniformMatrix2fv = SDL_GL_GetProcAddress("glProgramUniformMatrix2fv");
-	PROC_CAST glProgramUniformMatrix3fv = SDL_GL_GetProcAddress("glProgramUniformMatrix3fv");
-	PROC_CAST glProgramUniformMatrix4fv = SDL_GL_GetProcAddress("glProgramUniformMatrix4fv");
-	PROC_CAST glProgramUniformMatrix2dv = SDL_GL_GetProcAddress("glProgramUniformMatrix2dv");
-	PROC_CAST glProgramUniformMatrix3dv = SDL_GL_GetProcAddress("glProgramUniformMatrix3dv");
-	PROC_CAST glProgramUniformMatrix4dv = SDL_GL_GetProcAddress("glProgramUniformMatrix4dv");
-	PROC_CAST glProgramUniformMatrix2x3fv = SDL_GL_GetProcAddress("glProgramUniformMatrix2x3fv");
-	PROC_CAST glProgramUniformMatrix3x2fv = SDL_GL_GetProcAddress("glProgramUniformMatrix3x2fv");
-	PROC_CAST glProgramUniformMatrix2x4fv = SDL_GL_GetProcAddress("glProgramUniformMatrix2x4fv");
-	PROC_CAST glProgramUniformMatrix4x2fv = SDL_GL_GetProcAddress("glProgramUniformMatrix4x2fv");
-	PROC_CAST glProgramUniformMatrix3x4fv = SDL_GL_GetProcAddress("glProgramUniformMatrix3x4fv");
-	PROC_CAST glProgramUniformMatrix4x3fv = SDL_GL_GetProcAddress("glProgramUniformMatrix4x3fv");
-	PROC_CAST glProgramUniformMatrix2x3dv = SDL_GL_GetProcAddress("glProgramUniformMatrix2x3dv");
-	PROC_CAST glProgramUniformMatrix3x2dv = SDL_GL_GetProcAddress("glProgramUniformMatrix3x2dv");
-	PROC_CAST glProgramUniformMatrix2x4dv = SDL_GL_GetProcAddress("glProgramUniformMatrix2x4dv");
-	PROC_CAST glProgramUniformMatrix4x2dv = SDL_GL_GetProcAddress("glProgramUniformMatrix4x2dv");
-	PROC_CAST glProgramUniformMatrix3x4dv = SDL_GL_GetProcAddress("glProgramUniformMatrix3x4dv");
-	PROC_CAST glProgramUniformMatrix4x3dv = SDL_GL_GetProcAddress("glProgramUniformMatrix4x3dv");
-	PROC_CAST glValidateProgramPipeline = SDL_GL_GetProcAddress("glValidateProgramPipeline");
-	PROC_CAST glGetProgramPipelineInfoLog = SDL_GL_GetProcAddress("glGetProgramPipelineInfoLog");
-	PROC_CAST glVertexAttribL1d = SDL_GL_GetProcAddress("glVertexAttribL1d");
-	PROC_CAST glVertexAttribL2d = SDL_GL_GetProcAddress("glVertexAttribL2d");
-	PROC_CAST glVertexAttribL3d = SDL_GL_GetProcAddress("glVertexAttribL3d");
-	PROC_CAST glVertexAttribL4d = SDL_GL_GetProcAddress("glVertexAttribL4d");
-	PROC_CAST glVertexAttribL1dv = SDL_GL_GetProcAddress("glVertexAttribL1dv");
-	PROC_CAST glVertexAttribL2dv = SDL_GL_GetProcAddress("glVertexAttribL2dv");
-	PROC_CAST glVertexAttribL3dv = SDL_GL_GetProcAddress("glVertexAttribL3dv");
-	PROC_CAST glVertexAttribL4dv = SDL_GL_GetProcAddress("glVertexAttribL4dv");
-	PROC_CAST glVertexAttribLPointer = SDL_GL_GetProcAddress("glVertexAttribLPointer");
-	PROC_CAST glGetVertexAttribLdv = SDL_GL_GetProcAddress("glGetVertexAttribLdv");
-	PROC_CAST glViewportArrayv = SDL_GL_GetProcAddress("glViewportArrayv");
-	PROC_CAST glViewportIndexedf = SDL_GL_GetProcAddress("glViewportIndexedf");
-	PROC_CAST glViewportIndexedfv = SDL_GL_GetProcAddress("glViewportIndexedfv");
-	PROC_CAST glScissorArrayv = SDL_GL_GetProcAddress("glScissorArrayv");
-	PROC_CAST glScissorIndexed = SDL_GL_GetProcAddress("glScissorIndexed");
-	PROC_CAST glScissorIndexedv = SDL_GL_GetProcAddress("glScissorIndexedv");
-	PROC_CAST glDepthRangeArrayv = SDL_GL_GetProcAddress("glDepthRangeArrayv");
-	PROC_CAST glDepthRangeIndexed = SDL_GL_GetProcAddress("glDepthRangeIndexed");
-	PROC_CAST glGetFloati_v = SDL_GL_GetProcAddress("glGetFloati_v");
-	PROC_CAST glGetDoublei_v = SDL_GL_GetProcAddress("glGetDoublei_v");
-	PROC_CAST glDrawArraysInstancedBaseInstance = SDL_GL_GetProcAddress("glDrawArraysInstancedBaseInstance");
-	PROC_CAST glDrawElementsInstancedBaseInstance = SDL_GL_GetProcAddress("glDrawElementsInstancedBaseInstance");
-	PROC_CAST glDrawElementsInstancedBaseVertexBaseInstance = SDL_GL_GetProcAddress("glDrawElementsInstancedBaseVertexBaseInstance");
-	PROC_CAST glGetInternalformativ = SDL_GL_GetProcAddress("glGetInternalformativ");
-	PROC_CAST glGetActiveAtomicCounterBufferiv = SDL_GL_GetProcAddress("glGetActiveAtomicCounterBufferiv");
-	PROC_CAST glBindImageTexture = SDL_GL_GetProcAddress("glBindImageTexture");
-	PROC_CAST glMemoryBarrier = SDL_GL_GetProcAddress("glMemoryBarrier");
-	PROC_CAST glTexStorage1D = SDL_GL_GetProcAddress("glTexStorage1D");
-	PROC_CAST glTexStorage2D = SDL_GL_GetProcAddress("glTexStorage2D");
-	PROC_CAST glTexStorage3D = SDL_GL_GetProcAddress("glTexStorage3D");
-	PROC_CAST glDrawTransformFeedbackInstanced = SDL_GL_GetProcAddress("glDrawTransformFeedbackInstanced");
-	PROC_CAST glDrawTransformFeedbackStreamInstanced = SDL_GL_GetProcAddress("glDrawTransformFeedbackStreamInstanced");
-	PROC_CAST glClearBufferData = SDL_GL_GetProcAddress("glClearBufferData");
-	PROC_CAST glClearBufferSubData = SDL_GL_GetProcAddress("glClearBufferSubData");
-	PROC_CAST glDispatchCompute = SDL_GL_GetProcAddress("glDispatchCompute");
-	PROC_CAST glDispatchComputeIndirect = SDL_GL_GetProcAddress("glDispatchComputeIndirect");
-	PROC_CAST glCopyImageSubData = SDL_GL_GetProcAddress("glCopyImageSubData");
-	PROC_CAST glFramebufferParameteri = SDL_GL_GetProcAddress("glFramebufferParameteri");
-	PROC_CAST glGetFramebufferParameteriv = SDL_GL_GetProcAddress("glGetFramebufferParameteriv");
-	PROC_CAST glGetInternalformati64v = SDL_GL_GetProcAddress("glGetInternalformati64v");
-	PROC_CAST glInvalidateTexSubImage = SDL_GL_GetProcAddress("glInvalidateTexSubImage");
-	PROC_CAST glInvalidateTexImage = SDL_GL_GetProcAddress("glInvalidateTexImage");
-	PROC_CAST glInvalidateBufferSubData = SDL_GL_GetProcAddress("glInvalidateBufferSubData");
-	PROC_CAST glInvalidateBufferData = SDL_GL_GetProcAddress("glInvalidateBufferData");
-	PROC_CAST glInvalidateFramebuffer = SDL_GL_GetProcAddress("glInvalidateFramebuffer");
-	PROC_CAST glInvalidateSubFramebuffer = SDL_GL_GetProcAddress("glInvalidateSubFramebuffer");
-	PROC_CAST glMultiDrawArraysIndirect = SDL_GL_GetProcAddress("glMultiDrawArraysIndirect");
-	PROC_CAST glMultiDrawElementsIndirect = SDL_GL_GetProcAddress("glMultiDrawElementsIndirect");
-	PROC_CAST glGetProgramInterfaceiv = SDL_GL_GetProcAddress("glGetProgramInterfaceiv");
-	PROC_CAST glGetProgramResourceIndex = SDL_GL_GetProcAddress("glGetProgramResourceIndex");
-	PROC_CAST glGetProgramResourceName = SDL_GL_GetProcAddress("glGetProgramResourceName");
-	PROC_CAST glGetProgramResourceiv = SDL_GL_GetProcAddress("glGetProgramResourceiv");
-	PROC_CAST glGetProgramResourceLocation = SDL_GL_GetProcAddress("glGetProgramResourceLocation");
-	PROC_CAST glGetProgramResourceLocationIndex = SDL_GL_GetProcAddress("glGetProgramResourceLocationIndex");
-	PROC_CAST glShaderStorageBlockBinding = SDL_GL_GetProcAddress("glShaderStorageBlockBinding");
-	PROC_CAST glTexBufferRange = SDL_GL_GetProcAddress("glTexBufferRange");
-	PROC_CAST glTexStorage2DMultisample = SDL_GL_GetProcAddress("glTexStorage2DMultisample");
-	PROC_CAST glTexStorage3DMultisample = SDL_GL_GetProcAddress("glTexStorage3DMultisample");
-	PROC_CAST glTextureView = SDL_GL_GetProcAddress("glTextureView");
-	PROC_CAST glBindVertexBuffer = SDL_GL_GetProcAddress("glBindVertexBuffer");
-	PROC_CAST glVertexAttribFormat = SDL_GL_GetProcAddress("glVertexAttribFormat");
-	PROC_CAST glVertexAttribIFormat = SDL_GL_GetProcAddress("glVertexAttribIFormat");
-	PROC_CAST glVertexAttribLFormat = SDL_GL_GetProcAddress("glVertexAttribLFormat");
-	PROC_CAST glVertexAttribBinding = SDL_GL_GetProcAddress("glVertexAttribBinding");
-	PROC_CAST glVertexBindingDivisor = SDL_GL_GetProcAddress("glVertexBindingDivisor");
-	PROC_CAST glDebugMessageControl = SDL_GL_GetProcAddress("glDebugMessageControl");
-	PROC_CAST glDebugMessageInsert = SDL_GL_GetProcAddress("glDebugMessageInsert");
-	PROC_CAST glDebugMessageCallback = SDL_GL_GetProcAddress("glDebugMessageCallback");
-	PROC_CAST glGetDebugMessageLog = SDL_GL_GetProcAddress("glGetDebugMessageLog");
-	PROC_CAST glPushDebugGroup = SDL_GL_GetProcAddress("glPushDebugGroup");
-	PROC_CAST glPopDebugGroup = SDL_GL_GetProcAddress("glPopDebugGroup");
-	PROC_CAST glObjectLabel = SDL_GL_GetProcAddress("glObjectLabel");
-	PROC_CAST glGetObjectLabel = SDL_GL_GetProcAddress("glGetObjectLabel");
-	PROC_CAST glObjectPtrLabel = SDL_GL_GetProcAddress("glObjectPtrLabel");
-	PROC_CAST glGetObjectPtrLabel = SDL_GL_GetProcAddress("glGetObjectPtrLabel");
-	PROC_CAST glBufferStorage = SDL_GL_GetProcAddress("glBufferStorage");
-	PROC_CAST glClearTexImage = SDL_GL_GetProcAddress("glClearTexImage");
-	PROC_CAST glClearTexSubImage = SDL_GL_GetProcAddress("glClearTexSubImage");
-	PROC_CAST glBindBuffersBase = SDL_GL_GetProcAddress("glBindBuffersBase");
-	PROC_CAST glBindBuffersRange = SDL_GL_GetProcAddress("glBindBuffersRange");
-	PROC_CAST glBindTextures = SDL_GL_GetProcAddress("glBindTextures");
-	PROC_CAST glBindSamplers = SDL_GL_GetProcAddress("glBindSamplers");
-	PROC_CAST glBindImageTextures = SDL_GL_GetProcAddress("glBindImageTextures");
-	PROC_CAST glBindVertexBuffers = SDL_GL_GetProcAddress("glBindVertexBuffers");
-	PROC_CAST glClipControl = SDL_GL_GetProcAddress("glClipControl");
-	PROC_CAST glCreateTransformFeedbacks = SDL_GL_GetProcAddress("glCreateTransformFeedbacks");
-	PROC_CAST glTransformFeedbackBufferBase = SDL_GL_GetProcAddress("glTransformFeedbackBufferBase");
-	PROC_CAST glTransformFeedbackBufferRange = SDL_GL_GetProcAddress("glTransformFeedbackBufferRange");
-	PROC_CAST glGetTransformFeedbackiv = SDL_GL_GetProcAddress("glGetTransformFeedbackiv");
-	PROC_CAST glGetTransformFeedbacki_v = SDL_GL_GetProcAddress("glGetTransformFeedbacki_v");
-	PROC_CAST glGetTransformFeedbacki64_v = SDL_GL_GetProcAddress("glGetTransformFeedbacki64_v");
-	PROC_CAST glCreateBuffers = SDL_GL_GetProcAddress("glCreateBuffers");
-	PROC_CAST glNamedBufferStorage = SDL_GL_GetProcAddress("glNamedBufferStorage");
-	PROC_CAST glNamedBufferData = SDL_GL_GetProcAddress("glNamedBufferData");
-	PROC_CAST glNamedBufferSubData = SDL_GL_GetProcAddress("glNamedBufferSubData");
-	PROC_CAST glCopyNamedBufferSubData = SDL_GL_GetProcAddress("glCopyNamedBufferSubData");
-	PROC_CAST glClearNamedBufferData = SDL_GL_GetProcAddress("glClearNamedBufferData");
-	PROC_CAST glClearNamedBufferSubData = SDL_GL_GetProcAddress("glClearNamedBufferSubData");
-	PROC_CAST glMapNamedBuffer = SDL_GL_GetProcAddress("glMapNamedBuffer");
-	PROC_CAST glMapNamedBufferRange = SDL_GL_GetProcAddress("glMapNamedBufferRange");
-	PROC_CAST glUnmapNamedBuffer = SDL_GL_GetProcAddress("glUnmapNamedBuffer");
-	PROC_CAST glFlushMappedNamedBufferRange = SDL_GL_GetProcAddress("glFlushMappedNamedBufferRange");
-	PROC_CAST glGetNamedBufferParameteriv = SDL_GL_GetProcAddress("glGetNamedBufferParameteriv");
-	PROC_CAST glGetNamedBufferParameteri64v = SDL_GL_GetProcAddress("glGetNamedBufferParameteri64v");
-	PROC_CAST glGetNamedBufferPointerv = SDL_GL_GetProcAddress("glGetNamedBufferPointerv");
-	PROC_CAST glGetNamedBufferSubData = SDL_GL_GetProcAddress("glGetNamedBufferSubData");
-	PROC_CAST glCreateFramebuffers = SDL_GL_GetProcAddress("glCreateFramebuffers");
-	PROC_CAST glNamedFramebufferRenderbuffer = SDL_GL_GetProcAddress("glNamedFramebufferRenderbuffer");
-	PROC_CAST glNamedFramebufferParameteri = SDL_GL_GetProcAddress("glNamedFramebufferParameteri");
-	PROC_CAST glNamedFramebufferTexture = SDL_GL_GetProcAddress("glNamedFramebufferTexture");
-	PROC_CAST glNamedFramebufferTextureLayer = SDL_GL_GetProcAddress("glNamedFramebufferTextureLayer");
-	PROC_CAST glNamedFramebufferDrawBuffer = SDL_GL_GetProcAddress("glNamedFramebufferDrawBuffer");
-	PROC_CAST glNamedFramebufferDrawBuffers = SDL_GL_GetProcAddress("glNamedFramebufferDrawBuffers");
-	PROC_CAST glNamedFramebufferReadBuffer = SDL_GL_GetProcAddress("glNamedFramebufferReadBuffer");
-	PROC_CAST glInvalidateNamedFramebufferData = SDL_GL_GetProcAddress("glInvalidateNamedFramebufferData");
-	PROC_CAST glInvalidateNamedFramebufferSubData = SDL_GL_GetProcAddress("glInvalidateNamedFramebufferSubData");
-	PROC_CAST glClearNamedFramebufferiv = SDL_GL_GetProcAddress("glClearNamedFramebufferiv");
-	PROC_CAST glClearNamedFramebufferuiv = SDL_GL_GetProcAddress("glClearNamedFramebufferuiv");
-	PROC_CAST glClearNamedFramebufferfv = SDL_GL_GetProcAddress("glClearNamedFramebufferfv");
-	PROC_CAST glClearNamedFramebufferfi = SDL_GL_GetProcAddress("glClearNamedFramebufferfi");
-	PROC_CAST glBlitNamedFramebuffer = SDL_GL_GetProcAddress("glBlitNamedFramebuffer");
-	PROC_CAST glCheckNamedFramebufferStatus = SDL_GL_GetProcAddress("glCheckNamedFramebufferStatus");
-	PROC_CAST glGetNamedFramebufferParameteriv = SDL_GL_GetProcAddress("glGetNamedFramebufferParameteriv");
-	PROC_CAST glGetNamedFramebufferAttachmentParameteriv = SDL_GL_GetProcAddress("glGetNamedFramebufferAttachmentParameteriv");
-	PROC_CAST glCreateRenderbuffers = SDL_GL_GetProcAddress("glCreateRenderbuffers");
-	PROC_CAST glNamedRenderbufferStorage = SDL_GL_GetProcAddress("glNamedRenderbufferStorage");
-	PROC_CAST glNamedRenderbufferStorageMultisample = SDL_GL_GetProcAddress("glNamedRenderbufferStorageMultisample");
-	PROC_CAST glGetNamedRenderbufferParameteriv = SDL_GL_GetProcAddress("glGetNamedRenderbufferParameteriv");
-	PROC_CAST glCreateTextures = SDL_GL_GetProcAddress("glCreateTextures");
-	PROC_CAST glTextureBuffer = SDL_GL_GetProcAddress("glTextureBuffer");
-	PROC_CAST glTextureBufferRange = SDL_GL_GetProcAddress("glTextureBufferRange");
-	PROC_CAST glTextureStorage1D = SDL_GL_GetProcAddress("glTextureStorage1D");
-	PROC_CAST glTextureStorage2D = SDL_GL_GetProcAddress("glTextureStorage2D");
-	PROC_CAST glTextureStorage3D = SDL_GL_GetProcAddress("glTextureStorage3D");
-	PROC_CAST glTextureStorage2DMultisample = SDL_GL_GetProcAddress("glTextureStorage2DMultisample");
-	PROC_CAST glTextureStorage3DMultisample = SDL_GL_GetProcAddress("glTextureStorage3DMultisample");
-	PROC_CAST glTextureSubImage1D = SDL_GL_GetProcAddress("glTextureSubImage1D");
-	PROC_CAST glTextureSubImage2D = SDL_GL_GetProcAddress("glTextureSubImage2D");
-	PROC_CAST glTextureSubImage3D = SDL_GL_GetProcAddress("glTextureSubImage3D");
-	PROC_CAST glCompressedTextureSubImage1D = SDL_GL_GetProcAddress("glCompressedTextureSubImage1D");
-	PROC_CAST glCompressedTextureSubImage2D = SDL_GL_GetProcAddress("glCompressedTextureSubImage2D");
-	PROC_CAST glCompressedTextureSubImage3D = SDL_GL_GetProcAddress("glCompressedTextureSubImage3D");
-	PROC_CAST glCopyTextureSubImage1D = SDL_GL_GetProcAddress("glCopyTextureSubImage1D");
-	PROC_CAST glCopyTextureSubImage2D = SDL_GL_GetProcAddress("glCopyTextureSubImage2D");
-	PROC_CAST glCopyTextureSubImage3D = SDL_GL_GetProcAddress("glCopyTextureSubImage3D");
-	PROC_CAST glTextureParameterf = SDL_GL_GetProcAddress("glTextureParameterf");
-	PROC_CAST glTextureParameterfv = SDL_GL_GetProcAddress("glTextureParameterfv");
-	PROC_CAST glTextureParameteri = SDL_GL_GetProcAddress("glTextureParameteri");
-	PROC_CAST glTextureParameterIiv = SDL_GL_GetProcAddress("glTextureParameterIiv");
-	PROC_CAST glTextureParameterIuiv = SDL_GL_GetProcAddress("glTextureParameterIuiv");
-	PROC_CAST glTextureParameteriv = SDL_GL_GetProcAddress("glTextureParameteriv");
-	PROC_CAST glGenerateTextureMipmap = SDL_GL_GetProcAddress("glGenerateTextureMipmap");
-	PROC_CAST glBindTextureUnit = SDL_GL_GetProcAddress("glBindTextureUnit");
-	PROC_CAST glGetTextureImage = SDL_GL_GetProcAddress("glGetTextureImage");
-	PROC_CAST glGetCompressedTextureImage = SDL_GL_GetProcAddress("glGetCompressedTextureImage");
-	PROC_CAST glGetTextureLevelParameterfv = SDL_GL_GetProcAddress("glGetTextureLevelParameterfv");
-	PROC_CAST glGetTextureLevelParameteriv = SDL_GL_GetProcAddress("glGetTextureLevelParameteriv");
-	PROC_CAST glGetTextureParameterfv = SDL_GL_GetProcAddress("glGetTextureParameterfv");
-	PROC_CAST glGetTextureParameterIiv = SDL_GL_GetProcAddress("glGetTextureParameterIiv");
-	PROC_CAST glGetTextureParameterIuiv = SDL_GL_GetProcAddress("glGetTextureParameterIuiv");
-	PROC_CAST glGetTextureParameteriv = SDL_GL_GetProcAddress("glGetTextureParameteriv");
-	PROC_CAST glCreateVertexArrays = SDL_GL_GetProcAddress("glCreateVertexArrays");
-	PROC_CAST glDisableVertexArrayAttrib = SDL_GL_GetProcAddress("glDisableVertexArrayAttrib");
-	PROC_CAST glEnableVertexArrayAttrib = SDL_GL_GetProcAddress("glEnableVertexArrayAttrib");
-	PROC_CAST glVertexArrayElementBuffer = SDL_GL_GetProcAddress("glVertexArrayElementBuffer");
-	PROC_CAST glVertexArrayVertexBuffer = SDL_GL_GetProcAddress("glVertexArrayVertexBuffer");
-	PROC_CAST glVertexArrayVertexBuffers = SDL_GL_GetProcAddress("glVertexArrayVertexBuffers");
-	PROC_CAST glVertexArrayAttribBinding = SDL_GL_GetProcAddress("glVertexArrayAttribBinding");
-	PROC_CAST glVertexArrayAttribFormat = SDL_GL_GetProcAddress("glVertexArrayAttribFormat");
-	PROC_CAST glVertexArrayAttribIFormat = SDL_GL_GetProcAddress("glVertexArrayAttribIFormat");
-	PROC_CAST glVertexArrayAttribLFormat = SDL_GL_GetProcAddress("glVertexArrayAttribLFormat");
-	PROC_CAST glVertexArrayBindingDivisor = SDL_GL_GetProcAddress("glVertexArrayBindingDivisor");
-	PROC_CAST glGetVertexArrayiv = SDL_GL_GetProcAddress("glGetVertexArrayiv");
-	PROC_CAST glGetVertexArrayIndexediv = SDL_GL_GetProcAddress("glGetVertexArrayIndexediv");
-	PROC_CAST glGetVertexArrayIndexed64iv = SDL_GL_GetProcAddress("glGetVertexArrayIndexed64iv");
-	PROC_CAST glCreateSamplers = SDL_GL_GetProcAddress("glCreateSamplers");
-	PROC_CAST glCreateProgramPipelines = SDL_GL_GetProcAddress("glCreateProgramPipelines");
-	PROC_CAST glCreateQueries = SDL_GL_GetProcAddress("glCreateQueries");
-	PROC_CAST glGetQueryBufferObjecti64v = SDL_GL_GetProcAddress("glGetQueryBufferObjecti64v");
-	PROC_CAST glGetQueryBufferObjectiv = SDL_GL_GetProcAddress("glGetQueryBufferObjectiv");
-	PROC_CAST glGetQueryBufferObjectui64v = SDL_GL_GetProcAddress("glGetQueryBufferObjectui64v");
-	PROC_CAST glGetQueryBufferObjectuiv = SDL_GL_GetProcAddress("glGetQueryBufferObjectuiv");
-	PROC_CAST glMemoryBarrierByRegion = SDL_GL_GetProcAddress("glMemoryBarrierByRegion");
-	PROC_CAST glGetTextureSubImage = SDL_GL_GetProcAddress("glGetTextureSubImage");
-	PROC_CAST glGetCompressedTextureSubImage = SDL_GL_GetProcAddress("glGetCompressedTextureSubImage");
-	PROC_CAST glGetGraphicsResetStatus = SDL_GL_GetProcAddress("glGetGraphicsResetStatus");
-	PROC_CAST glGetnCompressedTexImage = SDL_GL_GetProcAddress("glGetnCompressedTexImage");
-	PROC_CAST glGetnTexImage = SDL_GL_GetProcAddress("glGetnTexImage");
-	PROC_CAST glGetnUniformdv = SDL_GL_GetProcAddress("glGetnUniformdv");
-	PROC_CAST glGetnUniformfv = SDL_GL_GetProcAddress("glGetnUniformfv");
-	PROC_CAST glGetnUniformiv = SDL_GL_GetProcAddress("glGetnUniformiv");
-	PROC_CAST glGetnUniformuiv = SDL_GL_GetProcAddress("glGetnUniformuiv");
-	PROC_CAST glReadnPixels = SDL_GL_GetProcAddress("glReadnPixels");
-	PROC_CAST glTextureBarrier = SDL_GL_GetProcAddress("glTextureBarrier");
-	PROC_CAST glGetTextureHandleARB = SDL_GL_GetProcAddress("glGetTextureHandleARB");
-	PROC_CAST glGetTextureSamplerHandleARB = SDL_GL_GetProcAddress("glGetTextureSamplerHandleARB");
-	PROC_CAST glMakeTextureHandleResidentARB = SDL_GL_GetProcAddress("glMakeTextureHandleResidentARB");
-	PROC_CAST glMakeTextureHandleNonResidentARB = SDL_GL_GetProcAddress("glMakeTextureHandleNonResidentARB");
-	PROC_CAST glGetImageHandleARB = SDL_GL_GetProcAddress("glGetImageHandleARB");
-	PROC_CAST glMakeImageHandleResidentARB = SDL_GL_GetProcAddress("glMakeImageHandleResidentARB");
-	PROC_CAST glMakeImageHandleNonResidentARB = SDL_GL_GetProcAddress("glMakeImageHandleNonResidentARB");
-	PROC_CAST glUniformHandleui64ARB = SDL_GL_GetProcAddress("glUniformHandleui64ARB");
-	PROC_CAST glUniformHandleui64vARB = SDL_GL_GetProcAddress("glUniformHandleui64vARB");
-	PROC_CAST glProgramUniformHandleui64ARB = SDL_GL_GetProcAddress("glProgramUniformHandleui64ARB");
-	PROC_CAST glProgramUniformHandleui64vARB = SDL_GL_GetProcAddress("glProgramUniformHandleui64vARB");
-	PROC_CAST glIsTextureHandleResidentARB = SDL_GL_GetProcAddress("glIsTextureHandleResidentARB");
-	PROC_CAST glIsImageHandleResidentARB = SDL_GL_GetProcAddress("glIsImageHandleResidentARB");
-	PROC_CAST glVertexAttribL1ui64ARB = SDL_GL_GetProcAddress("glVertexAttribL1ui64ARB");
-	PROC_CAST glVertexAttribL1ui64vARB = SDL_GL_GetProcAddress("glVertexAttribL1ui64vARB");
-	PROC_CAST glGetVertexAttribLui64vARB = SDL_GL_GetProcAddress("glGetVertexAttribLui64vARB");
-	PROC_CAST glCreateSyncFromCLeventARB = SDL_GL_GetProcAddress("glCreateSyncFromCLeventARB");
-	PROC_CAST glDispatchComputeGroupSizeARB = SDL_GL_GetProcAddress("glDispatchComputeGroupSizeARB");
-	PROC_CAST glDebugMessageControlARB = SDL_GL_GetProcAddress("glDebugMessageControlARB");
-	PROC_CAST glDebugMessageInsertARB = SDL_GL_GetProcAddress("glDebugMessageInsertARB");
-	PROC_CAST glDebugMessageCallbackARB = SDL_GL_GetProcAddress("glDebugMessageCallbackARB");
-	PROC_CAST glGetDebugMessageLogARB = SDL_GL_GetProcAddress("glGetDebugMessageLogARB");
-	PROC_CAST glBlendEquationiARB = SDL_GL_GetProcAddress("glBlendEquationiARB");
-	PROC_CAST glBlendEquationSeparateiARB = SDL_GL_GetProcAddress("glBlendEquationSeparateiARB");
-	PROC_CAST glBlendFunciARB = SDL_GL_GetProcAddress("glBlendFunciARB");
-	PROC_CAST glBlendFuncSeparateiARB = SDL_GL_GetProcAddress("glBlendFuncSeparateiARB");
-	PROC_CAST glMultiDrawArraysIndirectCountARB = SDL_GL_GetProcAddress("glMultiDrawArraysIndirectCountARB");
-	PROC_CAST glMultiDrawElementsIndirectCountARB = SDL_GL_GetProcAddress("glMultiDrawElementsIndirectCountARB");
-	PROC_CAST glGetGraphicsResetStatusARB = SDL_GL_GetProcAddress("glGetGraphicsResetStatusARB");
-	PROC_CAST glGetnTexImageARB = SDL_GL_GetProcAddress("glGetnTexImageARB");
-	PROC_CAST glReadnPixelsARB = SDL_GL_GetProcAddress("glReadnPixelsARB");
-	PROC_CAST glGetnCompressedTexImageARB = SDL_GL_GetProcAddress("glGetnCompressedTexImageARB");
-	PROC_CAST glGetnUniformfvARB = SDL_GL_GetProcAddress("glGetnUniformfvARB");
-	PROC_CAST glGetnUniformivARB = SDL_GL_GetProcAddress("glGetnUniformivARB");
-	PROC_CAST glGetnUniformuivARB = SDL_GL_GetProcAddress("glGetnUniformuivARB");
-	PROC_CAST glGetnUniformdvARB = SDL_GL_GetProcAddress("glGetnUniformdvARB");
-	PROC_CAST glMinSampleShadingARB = SDL_GL_GetProcAddress("glMinSampleShadingARB");
-	PROC_CAST glNamedStringARB = SDL_GL_GetProcAddress("glNamedStringARB");
-	PROC_CAST glDeleteNamedStringARB = SDL_GL_GetProcAddress("glDeleteNamedStringARB");
-	PROC_CAST glCompileShaderIncludeARB = SDL_GL_GetProcAddress("glCompileShaderIncludeARB");
-	PROC_CAST glIsNamedStringARB = SDL_GL_GetProcAddress("glIsNamedStringARB");
-	PROC_CAST glGetNamedStringARB = SDL_GL_GetProcAddress("glGetNamedStringARB");
-	PROC_CAST glGetNamedStringivARB = SDL_GL_GetProcAddress("glGetNamedStringivARB");
-	PROC_CAST glBufferPageCommitmentARB = SDL_GL_GetProcAddress("glBufferPageCommitmentARB");
-	PROC_CAST glNamedBufferPageCommitmentEXT = SDL_GL_GetProcAddress("glNamedBufferPageCommitmentEXT");
-	PROC_CAST glNamedBufferPageCommitmentARB = SDL_GL_GetProcAddress("glNamedBufferPageCommitmentARB");
-	PROC_CAST glTexPageCommitmentARB = SDL_GL_GetProcAddress("glTexPageCommitmentARB");
+	OpenGL_Init(SDL_GL_GetProcAddress);
+}
+
+void OpenGL_Init(void* (*getProcAddress)(const char* proc))
+{
+	PROC_CAST glCullFace = getProcAddress("glCullFace");
+	PROC_CAST glFrontFace = getProcAddress("glFrontFace");
+	PROC_CAST glHint = getProcAddress("glHint");
+	PROC_CAST glLineWidth = getProcAddress("glLineWidth");
+	PROC_CAST glPointSize = getProcAddress("glPointSize");
+	PROC_CAST glPolygonMode = getProcAddress("glPolygonMode");
+	PROC_CAST glScissor = getProcAddress("glScissor");
+	PROC_CAST glTexParameterf = getProcAddress("glTexParameterf");
+	PROC_CAST glTexParameterfv = getProcAddress("glTexParameterfv");
+	PROC_CAST glTexParameteri = getProcAddress("glTexParameteri");
+	PROC_CAST glTexParameteriv = getProcAddress("glTexParameteriv");
+	PROC_CAST glTexImage1D = getProcAddress("glTexImage1D");
+	PROC_CAST glTexImage2D = getProcAddress("glTexImage2D");
+	PROC_CAST glDrawBuffer = getProcAddress("glDrawBuffer");
+	PROC_CAST glClear = getProcAddress("glClear");
+	PROC_CAST glClearColor = getProcAddress("glClearColor");
+	PROC_CAST glClearStencil = getProcAddress("glClearStencil");
+	PROC_CAST glClearDepth = getProcAddress("glClearDepth");
+	PROC_CAST glStencilMask = getProcAddress("glStencilMask");
+	PROC_CAST glColorMask = getProcAddress("glColorMask");
+	PROC_CAST glDepthMask = getProcAddress("glDepthMask");
+	PROC_CAST glDisable = getProcAddress("glDisable");
+	PROC_CAST glEnable = getProcAddress("glEnable");
+	PROC_CAST glFinish = getProcAddress("glFinish");
+	PROC_CAST glFlush = getProcAddress("glFlush");
+	PROC_CAST glBlendFunc = getProcAddress("glBlendFunc");
+	PROC_CAST glLogicOp = getProcAddress("glLogicOp");
+	PROC_CAST glStencilFunc = getProcAddress("glStencilFunc");
+	PROC_CAST glStencilOp = getProcAddress("glStencilOp");
+	PROC_CAST glDepthFunc = getProcAddress("glDepthFunc");
+	PROC_CAST glPixelStoref = getProcAddress("glPixelStoref");
+	PROC_CAST glPixelStorei = getProcAddress("glPixelStorei");
+	PROC_CAST glReadBuffer = getProcAddress("glReadBuffer");
+	PROC_CAST glReadPixels = getProcAddress("glReadPixels");
+	PROC_CAST glGetBooleanv = getProcAddress("glGetBooleanv");
+	PROC_CAST glGetDoublev = getProcAddress("glGetDoublev");
+	PROC_CAST glGetError = getProcAddress("glGetError");
+	PROC_CAST glGetFloatv = getProcAddress("glGetFloatv");
+	PROC_CAST glGetIntegerv = getProcAddress("glGetIntegerv");
+	PROC_CAST glGetString = getProcAddress("glGetString");
+	PROC_CAST glGetTexImage = getProcAddress("glGetTexImage");
+	PROC_CAST glGetTexParameterfv = getProcAddress("glGetTexParameterfv");
+	PROC_CAST glGetTexParameteriv = getProcAddress("glGetTexParameteriv");
+	PROC_CAST glGetTexLevelParameterfv = getProcAddress("glGetTexLevelParameterfv");
+	PROC_CAST glGetTexLevelParameteriv = getProcAddress("glGetTexLevelParameteriv");
+	PROC_CAST glIsEnabled = getProcAddress("glIsEnabled");
+	PROC_CAST glDepthRange = getProcAddress("glDepthRange");
+	PROC_CAST glViewport = getProcAddress("glViewport");
+	PROC_CAST glDrawArrays = getProcAddress("glDrawArrays");
+	PROC_CAST glDrawElements = getProcAddress("glDrawElements");
+	PROC_CAST glGetPointerv = getProcAddress("glGetPointerv");
+	PROC_CAST glPolygonOffset = getProcAddress("glPolygonOffset");
+	PROC_CAST glCopyTexImage1D = getProcAddress("glCopyTexImage1D");
+	PROC_CAST glCopyTexImage2D = getProcAddress("glCopyTexImage2D");
+	PROC_CAST glCopyTexSubImage1D = getProcAddress("glCopyTexSubImage1D");
+	PROC_CAST glCopyTexSubImage2D = getProcAddress("glCopyTexSubImage2D");
+	PROC_CAST glTexSubImage1D = getProcAddress("glTexSubImage1D");
+	PROC_CAST glTexSubImage2D = getProcAddress("glTexSubImage2D");
+	PROC_CAST glBindTexture = getProcAddress("glBindTexture");
+	PROC_CAST glDeleteTextures = getProcAddress("glDeleteTextures");
+	PROC_CAST glGenTextures = getProcAddress("glGenTextures");
+	PROC_CAST glIsTexture = getProcAddress("glIsTexture");
+	PROC_CAST glDrawRangeElements = getProcAddress("glDrawRangeElements");
+	PROC_CAST glTexImage3D = getProcAddress("glTexImage3D");
+	PROC_CAST glTexSubImage3D = getProcAddress("glTexSubImage3D");
+	PROC_CAST glCopyTexSubImage3D = getProcAddress("glCopyTexSubImage3D");
+	PROC_CAST glActiveTexture = getProcAddress("glActiveTexture");
+	PROC_CAST glSampleCoverage = getProcAddress("glSampleCoverage");
+	PROC_CAST glCompressedTexImage3D = getProcAddress("glCompressedTexImage3D");
+	PROC_CAST glCompressedTexImage2D = getProcAddress("glCompressedTexImage2D");
+	PROC_CAST glCompressedTexImage1D = getProcAddress("glCompressedTexImage1D");
+	PROC_CAST glCompressedTexSubImage3D = getProcAddress("glCompressedTexSubImage3D");
+	PROC_CAST glCompressedTexSubImage2D = getProcAddress("glCompressedTexSubImage2D");
+	PROC_CAST glCompressedTexSubImage1D = getProcAddress("glCompressedTexSubImage1D");
+	PROC_CAST glGetCompressedTexImage = getProcAddress("glGetCompressedTexImage");
+	PROC_CAST glBlendFuncSeparate = getProcAddress("glBlendFuncSeparate");
+	PROC_CAST glMultiDrawArrays = getProcAddress("glMultiDrawArrays");
+	PROC_CAST glMultiDrawElements = getProcAddress("glMultiDrawElements");
+	PROC_CAST glPointParameterf = getProcAddress("glPointParameterf");
+	PROC_CAST glPointParameterfv = getProcAddress("glPointParameterfv");
+	PROC_CAST glPointParameteri = getProcAddress("glPointParameteri");
+	PROC_CAST glPointParameteriv = getProcAddress("glPointParameteriv");
+	PROC_CAST glBlendColor = getProcAddress("glBlendColor");
+	PROC_CAST glBlendEquation = getProcAddress("glBlendEquation");
+	PROC_CAST glGenQueries = getProcAddress("glGenQueries");
+	PROC_CAST glDeleteQueries = getProcAddress("glDeleteQueries");
+	PROC_CAST glIsQuery = getProcAddress("glIsQuery");
+	PROC_CAST glBeginQuery = getProcAddress("glBeginQuery");
+	PROC_CAST glEndQuery = getProcAddress("glEndQuery");
+	PROC_CAST glGetQueryiv = getProcAddress("glGetQueryiv");
+	PROC_CAST glGetQueryObjectiv = getProcAddress("glGetQueryObjectiv");
+	PROC_CAST glGetQueryObjectuiv = getProcAddress("glGetQueryObjectuiv");
+	PROC_CAST glBindBuffer = getProcAddress("glBindBuffer");
+	PROC_CAST glDeleteBuffers = getProcAddress("glDeleteBuffers");
+	PROC_CAST glGenBuffers = getProcAddress("glGenBuffers");
+	PROC_CAST glIsBuffer = getProcAddress("glIsBuffer");
+	PROC_CAST glBufferData = getProcAddress("glBufferData");
+	PROC_CAST glBufferSubData = getProcAddress("glBufferSubData");
+	PROC_CAST glGetBufferSubData = getProcAddress("glGetBufferSubData");
+	PROC_CAST glMapBuffer = getProcAddress("glMapBuffer");
+	PROC_CAST glUnmapBuffer = getProcAddress("glUnmapBuffer");
+	PROC_CAST glGetBufferParameteriv = getProcAddress("glGetBufferParameteriv");
+	PROC_CAST glGetBufferPointerv = getProcAddress("glGetBufferPointerv");
+	PROC_CAST glBlendEquationSeparate = getProcAddress("glBlendEquationSeparate");
+	PROC_CAST glDrawBuffers = getProcAddress("glDrawBuffers");
+	PROC_CAST glStencilOpSeparate = getProcAddress("glStencilOpSeparate");
+	PROC_CAST glStencilFuncSeparate = getProcAddress("glStencilFuncSeparate");
+	PROC_CAST glStencilMaskSeparate = getProcAddress("glStencilMaskSeparate");
+	PROC_CAST glAttachShader = getProcAddress("glAttachShader");
+	PROC_CAST glBindAttribLocation = getProcAddress("glBindAttribLocation");
+	PROC_CAST glCompileShader = getProcAddress("glCompileShader");
+	PROC_CAST glCreateProgram = getProcAddress("glCreateProgram");
+	PROC_CAST glCreateShader = getProcAddress("glCreateShader");
+	PROC_CAST glDeleteProgram = getProcAddress("glDeleteProgram");
+	PROC_CAST glDeleteShader = getProcAddress("glDeleteShader");
+	PROC_CAST glDetachShader = getProcAddress("glDetachShader");
+	PROC_CAST glDisableVertexAttribArray = getProcAddress("glDisableVertexAttribArray");
+	PROC_CAST glEnableVertexAttribArray = getProcAddress("glEnableVertexAttribArray");
+	PROC_CAST glGetActiveAttrib = getProcAddress("glGetActiveAttrib");
+	PROC_CAST glGetActiveUniform = getProcAddress("glGetActiveUniform");
+	PROC_CAST glGetAttachedShaders = getProcAddress("glGetAttachedShaders");
+	PROC_CAST glGetAttribLocation = getProcAddress("glGetAttribLocation");
+	PROC_CAST glGetProgramiv = getProcAddress("glGetProgramiv");
+	PROC_CAST glGetProgramInfoLog = getProcAddress("glGetProgramInfoLog");
+	PROC_CAST glGetShaderiv = getProcAddress("glGetShaderiv");
+	PROC_CAST glGetShaderInfoLog = getProcAddress("glGetShaderInfoLog");
+	PROC_CAST glGetShaderSource = getProcAddress("glGetShaderSource");
+	PROC_CAST glGetUniformLocation = getProcAddress("glGetUniformLocation");
+	PROC_CAST glGetUniformfv = getProcAddress("glGetUniformfv");
+	PROC_CAST glGetUniformiv = getProcAddress("glGetUniformiv");
+	PROC_CAST glGetVertexAttribdv = getProcAddress("glGetVertexAttribdv");
+	PROC_CAST glGetVertexAttribfv = getProcAddress("glGetVertexAttribfv");
+	PROC_CAST glGetVertexAttribiv = getProcAddress("glGetVertexAttribiv");
+	PROC_CAST glGetVertexAttribPointerv = getProcAddress("glGetVertexAttribPointerv");
+	PROC_CAST glIsProgram = getProcAddress("glIsProgram");
+	PROC_CAST glIsShader = getProcAddress("glIsShader");
+	PROC_CAST glLinkProgram = getProcAddress("glLinkProgram");
+	PROC_CAST glShaderSource = getProcAddress("glShaderSource");
+	PROC_CAST glUseProgram = getProcAddress("glUseProgram");
+	PROC_CAST glUniform1f = getProcAddress("glUniform1f");
+	PROC_CAST glUniform2f = getProcAddress("glUniform2f");
+	PROC_CAST glUniform3f = getProcAddress("glUniform3f");
+	PROC_CAST glUniform4f = getProcAddress("glUniform4f");
+	PROC_CAST glUniform1i = getProcAddress("glUniform1i");
+	PROC_CAST glUniform2i = getProcAddress("glUniform2i");
+	PROC_CAST glUniform3i = getProcAddress("glUniform3i");
+	PROC_CAST glUniform4i = getProcAddress("glUniform4i");
+	PROC_CAST glUniform1fv = getProcAddress("glUniform1fv");
+	PROC_CAST glUniform2fv = getProcAddress("glUniform2fv");
+	PROC_CAST glUniform3fv = getProcAddress("glUniform3fv");
+	PROC_CAST glUniform4fv = getProcAddress("glUniform4fv");
+	PROC_CAST glUniform1iv = getProcAddress("glUniform1iv");
+	PROC_CAST glUniform2iv = getProcAddress("glUniform2iv");
+	PROC_CAST glUniform3iv = getProcAddress("glUniform3iv");
+	PROC_CAST glUniform4iv = getProcAddress("glUniform4iv");
+	PROC_CAST glUniformMatrix2fv = getProcAddress("glUniformMatrix2fv");
+	PROC_CAST glUniformMatrix3fv = getProcAddress("glUniformMatrix3fv");
+	PROC_CAST glUniformMatrix4fv = getProcAddress("glUniformMatrix4fv");
+	PROC_CAST glValidateProgram = getProcAddress("glValidateProgram");
+	PROC_CAST glVertexAttrib1d = getProcAddress("glVertexAttrib1d");
+	PROC_CAST glVertexAttrib1dv = getProcAddress("glVertexAttrib1dv");
+	PROC_CAST glVertexAttrib1f = getProcAddress("glVertexAttrib1f");
+	PROC_CAST glVertexAttrib1fv = getProcAddress("glVertexAttrib1fv");
+	PROC_CAST glVertexAttrib1s = getProcAddress("glVertexAttrib1s");
+	PROC_CAST glVertexAttrib1sv = getProcAddress("glVertexAttrib1sv");
+	PROC_CAST glVertexAttrib2d = getProcAddress("glVertexAttrib2d");
+	PROC_CAST glVertexAttrib2dv = getProcAddress("glVertexAttrib2dv");
+	PROC_CAST glVertexAttrib2f = getProcAddress("glVertexAttrib2f");
+	PROC_CAST glVertexAttrib2fv = getProcAddress("glVertexAttrib2fv");
+	PROC_CAST glVertexAttrib2s = getProcAddress("glVertexAttrib2s");
+	PROC_CAST glVertexAttrib2sv = getProcAddress("glVertexAttrib2sv");
+	PROC_CAST glVertexAttrib3d = getProcAddress("glVertexAttrib3d");
+	PROC_CAST glVertexAttrib3dv = getProcAddress("glVertexAttrib3dv");
+	PROC_CAST glVertexAttrib3f = getProcAddress("glVertexAttrib3f");
+	PROC_CAST glVertexAttrib3fv = getProcAddress("glVertexAttrib3fv");
+	PROC_CAST glVertexAttrib3s = getProcAddress("glVertexAttrib3s");
+	PROC_CAST glVertexAttrib3sv = getProcAddress("glVertexAttrib3sv");
+	PROC_CAST glVertexAttrib4Nbv = getProcAddress("glVertexAttrib4Nbv");
+	PROC_CAST glVertexAttrib4Niv = getProcAddress("glVertexAttrib4Niv");
+	PROC_CAST glVertexAttrib4Nsv = getProcAddress("glVertexAttrib4Nsv");
+	PROC_CAST glVertexAttrib4Nub = getProcAddress("glVertexAttrib4Nub");
+	PROC_CAST glVertexAttrib4Nubv = getProcAddress("glVertexAttrib4Nubv");
+	PROC_CAST glVertexAttrib4Nuiv = getProcAddress("glVertexAttrib4Nuiv");
+	PROC_CAST glVertexAttrib4Nusv = getProcAddress("glVertexAttrib4Nusv");
+	PROC_CAST glVertexAttrib4bv = getProcAddress("glVertexAttrib4bv");
+	PROC_CAST glVertexAttrib4d = getProcAddress("glVertexAttrib4d");
+	PROC_CAST glVertexAttrib4dv = getProcAddress("glVertexAttrib4dv");
+	PROC_CAST glVertexAttrib4f = getProcAddress("glVertexAttrib4f");
+	PROC_CAST glVertexAttrib4fv = getProcAddress("glVertexAttrib4fv");
+	PROC_CAST glVertexAttrib4iv = getProcAddress("glVertexAttrib4iv");
+	PROC_CAST glVertexAttrib4s = getProcAddress("glVertexAttrib4s");
+	PROC_CAST glVertexAttrib4sv = getProcAddress("glVertexAttrib4sv");
+	PROC_CAST glVertexAttrib4ubv = getProcAddress("glVertexAttrib4ubv");
+	PROC_CAST glVertexAttrib4uiv = getProcAddress("glVertexAttrib4uiv");
+	PROC_CAST glVertexAttrib4usv = getProcAddress("glVertexAttrib4usv");
+	PROC_CAST glVertexAttribPointer = getProcAddress("glVertexAttribPointer");
+	PROC_CAST glUniformMatrix2x3fv = getProcAddress("glUniformMatrix2x3fv");
+	PROC_CAST glUniformMatrix3x2fv = getProcAddress("glUniformMatrix3x2fv");
+	PROC_CAST glUniformMatrix2x4fv = getProcAddress("glUniformMatrix2x4fv");
+	PROC_CAST glUniformMatrix4x2fv = getProcAddress("glUniformMatrix4x2fv");
+	PROC_CAST glUniformMatrix3x4fv = getProcAddress("glUniformMatrix3x4fv");
+	PROC_CAST glUniformMatrix4x3fv = getProcAddress("glUniformMatrix4x3fv");
+	PROC_CAST glColorMaski = getProcAddress("glColorMaski");
+	PROC_CAST glGetBooleani_v = getProcAddress("glGetBooleani_v");
+	PROC_CAST glGetIntegeri_v = getProcAddress("glGetIntegeri_v");
+	PROC_CAST glEnablei = getProcAddress("glEnablei");
+	PROC_CAST glDisablei = getProcAddress("glDisablei");
+	PROC_CAST glIsEnabledi = getProcAddress("glIsEnabledi");
+	PROC_CAST glBeginTransformFeedback = getProcAddress("glBeginTransformFeedback");
+	PROC_CAST glEndTransformFeedback = getProcAddress("glEndTransformFeedback");
+	PROC_CAST glBindBufferRange = getProcAddress("glBindBufferRange");
+	PROC_CAST glBindBufferBase = getProcAddress("glBindBufferBase");
+	PROC_CAST glTransformFeedbackVaryings = getProcAddress("glTransformFeedbackVaryings");
+	PROC_CAST glGetTransformFeedbackVarying = getProcAddress("glGetTransformFeedbackVarying");
+	PROC_CAST glClampColor = getProcAddress("glClampColor");
+	PROC_CAST glBeginConditionalRender = getProcAddress("glBeginConditionalRender");
+	PROC_CAST glEndConditionalRender = getProcAddress("glEndConditionalRender");
+	PROC_CAST glVertexAttribIPointer = getProcAddress("glVertexAttribIPointer");
+	PROC_CAST glGetVertexAttribIiv = getProcAddress("glGetVertexAttribIiv");
+	PROC_CAST glGetVertexAttribIuiv = getProcAddress("glGetVertexAttribIuiv");
+	PROC_CAST glVertexAttribI1i = getProcAddress("glVertexAttribI1i");
+	PROC_CAST glVertexAttribI2i = getProcAddress("glVertexAttribI2i");
+	PROC_CAST glVertexAttribI3i = getProcAddress("glVertexAttribI3i");
+	PROC_CAST glVertexAttribI4i = getProcAddress("glVertexAttribI4i");
+	PROC_CAST glVertexAttribI1ui = getProcAddress("glVertexAttribI1ui");
+	PROC_CAST glVertexAttribI2ui = getProcAddress("glVertexAttribI2ui");
+	PROC_CAST glVertexAttribI3ui = getProcAddress("glVertexAttribI3ui");
+	PROC_CAST glVertexAttribI4ui = getProcAddress("glVertexAttribI4ui");
+	PROC_CAST glVertexAttribI1iv = getProcAddress("glVertexAttribI1iv");
+	PROC_CAST glVertexAttribI2iv = getProcAddress("glVertexAttribI2iv");
+	PROC_CAST glVertexAttribI3iv = getProcAddress("glVertexAttribI3iv");
+	PROC_CAST glVertexAttribI4iv = getProcAddress("glVertexAttribI4iv");
+	PROC_CAST glVertexAttribI1uiv = getProcAddress("glVertexAttribI1uiv");
+	PROC_CAST glVertexAttribI2uiv = getProcAddress("glVertexAttribI2uiv");
+	PROC_CAST glVertexAttribI3uiv = getProcAddress("glVertexAttribI3uiv");
+	PROC_CAST glVertexAttribI4uiv = getProcAddress("glVertexAttribI4uiv");
+	PROC_CAST glVertexAttribI4bv = getProcAddress("glVertexAttribI4bv");
+	PROC_CAST glVertexAttribI4sv = getProcAddress("glVertexAttribI4sv");
+	PROC_CAST glVertexAttribI4ubv = getProcAddress("glVertexAttribI4ubv");
+	PROC_CAST glVertexAttribI4usv = getProcAddress("glVertexAttribI4usv");
+	PROC_CAST glGetUniformuiv = getProcAddress("glGetUniformuiv");
+	PROC_CAST glBindFragDataLocation = getProcAddress("glBindFragDataLocation");
+	PROC_CAST glGetFragDataLocation = getProcAddress("glGetFragDataLocation");
+	PROC_CAST glUniform1ui = getProcAddress("glUniform1ui");
+	PROC_CAST glUniform2ui = getProcAddress("glUniform2ui");
+	PROC_CAST glUniform3ui = getProcAddress("glUniform3ui");
+	PROC_CAST glUniform4ui = getProcAddress("glUniform4ui");
+	PROC_CAST glUniform1uiv = getProcAddress("glUniform1uiv");
+	PROC_CAST glUniform2uiv = getProcAddress("glUniform2uiv");
+	PROC_CAST glUniform3uiv = getProcAddress("glUniform3uiv");
+	PROC_CAST glUniform4uiv = getProcAddress("glUniform4uiv");
+	PROC_CAST glTexParameterIiv = getProcAddress("glTexParameterIiv");
+	PROC_CAST glTexParameterIuiv = getProcAddress("glTexParameterIuiv");
+	PROC_CAST glGetTexParameterIiv = getProcAddress("glGetTexParameterIiv");
+	PROC_CAST glGetTexParameterIuiv = getProcAddress("glGetTexParameterIuiv");
+	PROC_CAST glClearBufferiv = getProcAddress("glClearBufferiv");
+	PROC_CAST glClearBufferuiv = getProcAddress("glClearBufferuiv");
+	PROC_CAST glClearBufferfv = getProcAddress("glClearBufferfv");
+	PROC_CAST glClearBufferfi = getProcAddress("glClearBufferfi");
+	PROC_CAST glGetStringi = getProcAddress("glGetStringi");
+	PROC_CAST glIsRenderbuffer = getProcAddress("glIsRenderbuffer");
+	PROC_CAST glBindRenderbuffer = getProcAddress("glBindRenderbuffer");
+	PROC_CAST glDeleteRenderbuffers = getProcAddress("glDeleteRenderbuffers");
+	PROC_CAST glGenRenderbuffers = getProcAddress("glGenRenderbuffers");
+	PROC_CAST glRenderbufferStorage = getProcAddress("glRenderbufferStorage");
+	PROC_CAST glGetRenderbufferParameteriv = getProcAddress("glGetRenderbufferParameteriv");
+	PROC_CAST glIsFramebuffer = getProcAddress("glIsFramebuffer");
+	PROC_CAST glBindFramebuffer = getProcAddress("glBindFramebuffer");
+	PROC_CAST glDeleteFramebuffers = getProcAddress("glDeleteFramebuffers");
+	PROC_CAST glGenFramebuffers = getProcAddress("glGenFramebuffers");
+	PROC_CAST glCheckFramebufferStatus = getProcAddress("glCheckFramebufferStatus");
+	PROC_CAST glFramebufferTexture1D = getProcAddress("glFramebufferTexture1D");
+	PROC_CAST glFramebufferTexture2D = getProcAddress("glFramebufferTexture2D");
+	PROC_CAST glFramebufferTexture3D = getProcAddress("glFramebufferTexture3D");
+	PROC_CAST glFramebufferRenderbuffer = getProcAddress("glFramebufferRenderbuffer");
+	PROC_CAST glGetFramebufferAttachmentParameteriv = getProcAddress("glGetFramebufferAttachmentParameteriv");
+	PROC_CAST glGenerateMipmap = getProcAddress("glGenerateMipmap");
+	PROC_CAST glBlitFramebuffer = getProcAddress("glBlitFramebuffer");
+	PROC_CAST glRenderbufferStorageMultisample = getProcAddress("glRenderbufferStorageMultisample");
+	PROC_CAST glFramebufferTextureLayer = getProcAddress("glFramebufferTextureLayer");
+	PROC_CAST glMapBufferRange = getProcAddress("glMapBufferRange");
+	PROC_CAST glFlushMappedBufferRange = getProcAddress("glFlushMappedBufferRange");
+	PROC_CAST glBindVertexArray = getProcAddress("glBindVertexArray");
+	PROC_CAST glDeleteVertexArrays = getProcAddress("glDeleteVertexArrays");
+	PROC_CAST glGenVertexArrays = getProcAddress("glGenVertexArrays");
+	PROC_CAST glIsVertexArray = getProcAddress("glIsVertexArray");
+	PROC_CAST glDrawArraysInstanced = getProcAddress("glDrawArraysInstanced");
+	PROC_CAST glDrawElementsInstanced = getProcAddress("glDrawElementsInstanced");
+	PROC_CAST glTexBuffer = getProcAddress("glTexBuffer");
+	PROC_CAST glPrimitiveRestartIndex = getProcAddress("glPrimitiveRestartIndex");
+	PROC_CAST glCopyBufferSubData = getProcAddress("glCopyBufferSubData");
+	PROC_CAST glGetUniformIndices = getProcAddress("glGetUniformIndices");
+	PROC_CAST glGetActiveUniformsiv = getProcAddress("glGetActiveUniformsiv");
+	PROC_CAST glGetActiveUniformName = getProcAddress("glGetActiveUniformName");
+	PROC_CAST glGetUniformBlockIndex = getProcAddress("glGetUniformBlockIndex");
+	PROC_CAST glGetActiveUniformBlockiv = getProcAddress("glGetActiveUniformBlockiv");
+	PROC_CAST glGetActiveUniformBlockName = getProcAddress("glGetActiveUniformBlockName");
+	PROC_CAST glUniformBlockBinding = getProcAddress("glUniformBlockBinding");
+	PROC_CAST glDrawElementsBaseVertex = getProcAddress("glDrawElementsBaseVertex");
+	PROC_CAST glDrawRangeElementsBaseVertex = getProcAddress("glDrawRangeElementsBaseVertex");
+	PROC_CAST glDrawElementsInstancedBaseVertex = getProcAddress("glDrawElementsInstancedBaseVertex");
+	PROC_CAST glMultiDrawElementsBaseVertex = getProcAddress("glMultiDrawElementsBaseVertex");
+	PROC_CAST glProvokingVertex = getProcAddress("glProvokingVertex");
+	PROC_CAST glFenceSync = getProcAddress("glFenceSync");
+	PROC_CAST glIsSync = getProcAddress("glIsSync");
+	PROC_CAST glDeleteSync = getProcAddress("glDeleteSync");
+	PROC_CAST glClientWaitSync = getProcAddress("glClientWaitSync");
+	PROC_CAST glWaitSync = getProcAddress("glWaitSync");
+	PROC_CAST glGetInteger64v = getProcAddress("glGetInteger64v");
+	PROC_CAST glGetSynciv = getProcAddress("glGetSynciv");
+	PROC_CAST glGetInteger64i_v = getProcAddress("glGetInteger64i_v");
+	PROC_CAST glGetBufferParameteri64v = getProcAddress("glGetBufferParameteri64v");
+	PROC_CAST glFramebufferTexture = getProcAddress("glFramebufferTexture");
+	PROC_CAST glTexImage2DMultisample = getProcAddress("glTexImage2DMultisample");
+	PROC_CAST glTexImage3DMultisample = getProcAddress("glTexImage3DMultisample");
+	PROC_CAST glGetMultisamplefv = getProcAddress("glGetMultisamplefv");
+	PROC_CAST glSampleMaski = getProcAddress("glSampleMaski");
+	PROC_CAST glBindFragDataLocationIndexed = getProcAddress("glBindFragDataLocationIndexed");
+	PROC_CAST glGetFragDataIndex = getProcAddress("glGetFragDataIndex");
+	PROC_CAST glGenSamplers = getProcAddress("glGenSamplers");
+	PROC_CAST glDeleteSamplers = getProcAddress("glDeleteSamplers");
+	PROC_CAST glIsSampler = getProcAddress("glIsSampler");
+	PROC_CAST glBindSampler = getProcAddress("glBindSampler");
+	PROC_CAST glSamplerParameteri = getProcAddress("glSamplerParameteri");
+	PROC_CAST glSamplerParameteriv = getProcAddress("glSamplerParameteriv");
+	PROC_CAST glSamplerParameterf = getProcAddress("glSamplerParameterf");
+	PROC_CAST glSamplerParameterfv = getProcAddress("glSamplerParameterfv");
+	PROC_CAST glSamplerParameterIiv = getProcAddress("glSamplerParameterIiv");
+	PROC_CAST glSamplerParameterIuiv = getProcAddress("glSamplerParameterIuiv");
+	PROC_CAST glGetSamplerParameteriv = getProcAddress("glGetSamplerParameteriv");
+	PROC_CAST glGetSamplerParameterIiv = getProcAddress("glGetSamplerParameterIiv");
+	PROC_CAST glGetSamplerParameterfv = getProcAddress("glGetSamplerParameterfv");
+	PROC_CAST glGetSamplerParameterIuiv = getProcAddress("glGetSamplerParameterIuiv");
+	PROC_CAST glQueryCounter = getProcAddress("glQueryCounter");
+	PROC_CAST glGetQueryObjecti64v = getProcAddress("glGetQueryObjecti64v");
+	PROC_CAST glGetQueryObjectui64v = getProcAddress("glGetQueryObjectui64v");
+	PROC_CAST glVertexAttribDivisor = getProcAddress("glVertexAttribDivisor");
+	PROC_CAST glVertexAttribP1ui = getProcAddress("glVertexAttribP1ui");
+	PROC_CAST glVertexAttribP1uiv = getProcAddress("glVertexAttribP1uiv");
+	PROC_CAST glVertexAttribP2ui = getProcAddress("glVertexAttribP2ui");
+	PROC_CAST glVertexAttribP2uiv = getProcAddress("glVertexAttribP2uiv");
+	PROC_CAST glVertexAttribP3ui = getProcAddress("glVertexAttribP3ui");
+	PROC_CAST glVertexAttribP3uiv = getProcAddress("glVertexAttribP3uiv");
+	PROC_CAST glVertexAttribP4ui = getProcAddress("glVertexAttribP4ui");
+	PROC_CAST glVertexAttribP4uiv = getProcAddress("glVertexAttribP4uiv");
+	PROC_CAST glMinSampleShading = getProcAddress("glMinSampleShading");
+	PROC_CAST glBlendEquationi = getProcAddress("glBlendEquationi");
+	PROC_CAST glBlendEquationSeparatei = getProcAddress("glBlendEquationSeparatei");
+	PROC_CAST glBlendFunci = getProcAddress("glBlendFunci");
+	PROC_CAST glBlendFuncSeparatei = getProcAddress("glBlendFuncSeparatei");
+	PROC_CAST glDrawArraysIndirect = getProcAddress("glDrawArraysIndirect");
+	PROC_CAST glDrawElementsIndirect = getProcAddress("glDrawElementsIndirect");
+	PROC_CAST glUniform1d = getProcAddress("glUniform1d");
+	PROC_CAST glUniform2d = getProcAddress("glUniform2d");
+	PROC_CAST glUniform3d = getProcAddress("glUniform3d");
+	PROC_CAST glUniform4d = getProcAddress("glUniform4d");
+	PROC_CAST glUniform1dv = getProcAddress("glUniform1dv");
+	PROC_CAST glUniform2dv = getProcAddress("glUniform2dv");
+	PROC_CAST glUniform3dv = getProcAddress("glUniform3dv");
+	PROC_CAST glUniform4dv = getProcAddress("glUniform4dv");
+	PROC_CAST glUniformMatrix2dv = getProcAddress("glUniformMatrix2dv");
+	PROC_CAST glUniformMatrix3dv = getProcAddress("glUniformMatrix3dv");
+	PROC_CAST glUniformMatrix4dv = getProcAddress("glUniformMatrix4dv");
+	PROC_CAST glUniformMatrix2x3dv = getProcAddress("glUniformMatrix2x3dv");
+	PROC_CAST glUniformMatrix2x4dv = getProcAddress("glUniformMatrix2x4dv");
+	PROC_CAST glUniformMatrix3x2dv = getProcAddress("glUniformMatrix3x2dv");
+	PROC_CAST glUniformMatrix3x4dv = getProcAddress("glUniformMatrix3x4dv");
+	PROC_CAST glUniformMatrix4x2dv = getProcAddress("glUniformMatrix4x2dv");
+	PROC_CAST glUniformMatrix4x3dv = getProcAddress("glUniformMatrix4x3dv");
+	PROC_CAST glGetUniformdv = getProcAddress("glGetUniformdv");
+	PROC_CAST glGetSubroutineUniformLocation = getProcAddress("glGetSubroutineUniformLocation");
+	PROC_CAST glGetSubroutineIndex = getProcAddress("glGetSubroutineIndex");
+	PROC_CAST glGetActiveSubroutineUniformiv = getProcAddress("glGetActiveSubroutineUniformiv");
+	PROC_CAST glGetActiveSubroutineUniformName = getProcAddress("glGetActiveSubroutineUniformName");
+	PROC_CAST glGetActiveSubroutineName = getProcAddress("glGetActiveSubroutineName");
+	PROC_CAST glUniformSubroutinesuiv = getProcAddress("glUniformSubroutinesuiv");
+	PROC_CAST glGetUniformSubroutineuiv = getProcAddress("glGetUniformSubroutineuiv");
+	PROC_CAST glGetProgramStageiv = getProcAddress("glGetProgramStageiv");
+	PROC_CAST glPatchParameteri = getProcAddress("glPatchParameteri");
+	PROC_CAST glPatchParameterfv = getProcAddress("glPatchParameterfv");
+	PROC_CAST glBindTransformFeedback = getProcAddress("glBindTransformFeedback");
+	PROC_CAST glDeleteTransformFeedbacks = getProcAddress("glDeleteTransformFeedbacks");
+	PROC_CAST glGenTransformFeedbacks = getProcAddress("glGenTransformFeedbacks");
+	PROC_CAST glIsTransformFeedback = getProcAddress("glIsTransformFeedback");
+	PROC_CAST glPauseTransformFeedback = getProcAddress("glPauseTransformFeedback");
+	PROC_CAST glResumeTransformFeedback = getProcAddress("glResumeTransformFeedback");
+	PROC_CAST glDrawTransformFeedback = getProcAddress("glDrawTransformFeedback");
+	PROC_CAST glDrawTransformFeedbackStream = getProcAddress("glDrawTransformFeedbackStream");
+	PROC_CAST glBeginQueryIndexed = getProcAddress("glBeginQueryIndexed");
+	PROC_CAST glEndQueryIndexed = getProcAddress("glEndQueryIndexed");
+	PROC_CAST glGetQueryIndexediv = getProcAddress("glGetQueryIndexediv");
+	PROC_CAST glReleaseShaderCompiler = getProcAddress("glReleaseShaderCompiler");
+	PROC_CAST glShaderBinary = getProcAddress("glShaderBinary");
+	PROC_CAST glGetShaderPrecisionFormat = getProcAddress("glGetShaderPrecisionFormat");
+	PROC_CAST glDepthRangef = getProcAddress("glDepthRangef");
+	PROC_CAST glClearDepthf = getProcAddress("glClearDepthf");
+	PROC_CAST glGetProgramBinary = getProcAddress("glGetProgramBinary");
+	PROC_CAST glProgramBinary = getProcAddress("glProgramBinary");
+	PROC_CAST glProgramParameteri = getProcAddress("glProgramParameteri");
+	PROC_CAST glUseProgramStages = getProcAddress("glUseProgramStages");
+	PROC_CAST glActiveShaderProgram = getProcAddress("glActiveShaderProgram");
+	PROC_CAST glCreateShaderProgramv = getProcAddress("glCreateShaderProgramv");
+	PROC_CAST glBindProgramPipeline = getProcAddress("glBindProgramPipeline");
+	PROC_CAST glDeleteProgramPipelines = getProcAddress("glDeleteProgramPipelines");
+	PROC_CAST glGenProgramPipelines = getProcAddress("glGenProgramPipelines");
+	PROC_CAST glIsProgramPipeline = getProcAddress("glIsProgramPipeline");
+	PROC_CAST glGetProgramPipelineiv = getProcAddress("glGetProgramPipelineiv");
+	PROC_CAST glProgramUniform1i = getProcAddress("glProgramUniform1i");
+	PROC_CAST glProgramUniform1iv = getProcAddress("glProgramUniform1iv");
+	PROC_CAST glProgramUniform1f = getProcAddress("glProgramUniform1f");
+	PROC_CAST glProgramUniform1fv = getProcAddress("glProgramUniform1fv");
+	PROC_CAST glProgramUniform1d = getProcAddress("glProgramUniform1d");
+	PROC_CAST glProgramUniform1dv = getProcAddress("glProgramUniform1dv");
+	PROC_CAST glProgramUniform1ui = getProcAddress("glProgramUniform1ui");
+	PROC_CAST glProgramUniform1uiv = getProcAddress("glProgramUniform1uiv");
+	PROC_CAST glProgramUniform2i = getProcAddress("glProgramUniform2i");
+	PROC_CAST glProgramUniform2iv = getProcAddress("glProgramUniform2iv");
+	PROC_CAST glProgramUniform2f = getProcAddress("glProgramUniform2f");
+	PROC_CAST glProgramUniform2fv = getProcAddress("glProgramUniform2fv");
+	PROC_CAST glProgramUniform2d = getProcAddress("glProgramUniform2d");
+	PROC_CAST glProgramUniform2dv = getProcAddress("glProgramUniform2dv");
+	PROC_CAST glProgramUniform2ui = getProcAddress("glProgramUniform2ui");
+	PROC_CAST glProgramUniform2uiv = getProcAddress("glProgramUniform2uiv");
+	PROC_CAST glProgramUniform3i = getProcAddress("glProgramUniform3i");
+	PROC_CAST glProgramUniform3iv = getProcAddress("glProgramUniform3iv");
+	PROC_CAST glProgramUniform3f = getProcAddress("glProgramUniform3f");
+	PROC_CAST glProgramUniform3fv = getProcAddress("glProgramUniform3fv");
+	PROC_CAST glProgramUniform3d = getProcAddress("glProgramUniform3d");
+	PROC_CAST glProgramUniform3dv = getProcAddress("glProgramUniform3dv");
+	PROC_CAST glProgramUniform3ui = getProcAddress("glProgramUniform3ui");
+	PROC_CAST glProgramUniform3uiv = getProcAddress("glProgramUniform3uiv");
+	PROC_CAST glProgramUniform4i = getProcAddress("glProgramUniform4i");
+	PROC_CAST glProgramUniform4iv = getProcAddress("glProgramUniform4iv");
+	PROC_CAST glProgramUniform4f = getProcAddress("glProgramUniform4f");
+	PROC_CAST glProgramUniform4fv = getProcAddress("glProgramUniform4fv");
+	PROC_CAST glProgramUniform4d = getProcAddress("glProgramUniform4d");
+	PROC_CAST glProgramUniform4dv = getProcAddress("glProgramUniform4dv");
+	PROC_CAST glProgramUniform4ui = getProcAddress("glProgramUniform4ui");
+	PROC_CAST glProgramUniform4uiv = getProcAddress("glProgramUniform4uiv");
+	PROC_CAST glProgramUniformMatrix2fv = getProcAddress("glProgramUniformMatrix2fv");
+	PROC_CAST glProgramUniformMatrix3fv = getProcAddress("glProgramUniformMatrix3fv");
+	PROC_CAST glProgramUniformMatrix4fv = getProcAddress("glProgramUniformMatrix4fv");
+	PROC_CAST glProgramUniformMatrix2dv = getProcAddress("glProgramUniformMatrix2dv");
+	PROC_CAST glProgramUniformMatrix3dv = getProcAddress("glProgramUniformMatrix3dv");
+	PROC_CAST glProgramUniformMatrix4dv = getProcAddress("glProgramUniformMatrix4dv");
+	PROC_CAST glProgramUniformMatrix2x3fv = getProcAddress("glProgramUniformMatrix2x3fv");
+	PROC_CAST glProgramUniformMatrix3x2fv = getProcAddress("glProgramUniformMatrix3x2fv");
+	PROC_CAST glProgramUniformMatrix2x4fv = getProcAddress("glProgramUniformMatrix2x4fv");
+	PROC_CAST glProgramUniformMatrix4x2fv = getProcAddress("glProgramUniformMatrix4x2fv");
+	PROC_CAST glProgramUniformMatrix3x4fv = getProcAddress("glProgramUniformMatrix3x4fv");
+	PROC_CAST glProgramUniformMatrix4x3fv = getProcAddress("glProgramUniformMatrix4x3fv");
+	PROC_CAST glProgramUniformMatrix2x3dv = getProcAddress("glProgramUniformMatrix2x3dv");
+	PROC_CAST glProgramUniformMatrix3x2dv = getProcAddress("glProgramUniformMatrix3x2dv");
+	PROC_CAST glProgramUniformMatrix2x4dv = getProcAddress("glProgramUniformMatrix2x4dv");
+	PROC_CAST glProgramUniformMatrix4x2dv = getProcAddress("glProgramUniformMatrix4x2dv");
+	PROC_CAST glProgramUniformMatrix3x4dv = getProcAddress("glProgramUniformMatrix3x4dv");
+	PROC_CAST glProgramUniformMatrix4x3dv = getProcAddress("glProgramUniformMatrix4x3dv");
+	PROC_CAST glValidateProgramPipeline = getProcAddress("glValidateProgramPipeline");
+	PROC_CAST glGetProgramPipelineInfoLog = getProcAddress("glGetProgramPipelineInfoLog");
+	PROC_CAST glVertexAttribL1d = getProcAddress("glVertexAttribL1d");
+	PROC_CAST glVertexAttribL2d = getProcAddress("glVertexAttribL2d");
+	PROC_CAST glVertexAttribL3d = getProcAddress("glVertexAttribL3d");
+	PROC_CAST glVertexAttribL4d = getProcAddress("glVertexAttribL4d");
+	PROC_CAST glVertexAttribL1dv = getProcAddress("glVertexAttribL1dv");
+	PROC_CAST glVertexAttribL2dv = getProcAddress("glVertexAttribL2dv");
+	PROC_CAST glVertexAttribL3dv = getProcAddress("glVertexAttribL3dv");
+	PROC_CAST glVertexAttribL4dv = getProcAddress("glVertexAttribL4dv");
+	PROC_CAST glVertexAttribLPointer = getProcAddress("glVertexAttribLPointer");
+	PROC_CAST glGetVertexAttribLdv = getProcAddress("glGetVertexAttribLdv");
+	PROC_CAST glViewportArrayv = getProcAddress("glViewportArrayv");
+	PROC_CAST glViewportIndexedf = getProcAddress("glViewportIndexedf");
+	PROC_CAST glViewportIndexedfv = getProcAddress("glViewportIndexedfv");
+	PROC_CAST glScissorArrayv = getProcAddress("glScissorArrayv");
+	PROC_CAST glScissorIndexed = getProcAddress("glScissorIndexed");
+	PROC_CAST glScissorIndexedv = getProcAddress("glScissorIndexedv");
+	PROC_CAST glDepthRangeArrayv = getProcAddress("glDepthRangeArrayv");
+	PROC_CAST glDepthRangeIndexed = getProcAddress("glDepthRangeIndexed");
+	PROC_CAST glGetFloati_v = getProcAddress("glGetFloati_v");
+	PROC_CAST glGetDoublei_v = getProcAddress("glGetDoublei_v");
+	PROC_CAST glDrawArraysInstancedBaseInstance = getProcAddress("glDrawArraysInstancedBaseInstance");
+	PROC_CAST glDrawElementsInstancedBaseInstance = getProcAddress("glDrawElementsInstancedBaseInstance");
+	PROC_CAST glDrawElementsInstancedBaseVertexBaseInstance = getProcAddress("glDrawElementsInstancedBaseVertexBaseInstance");
+	PROC_CAST glGetInternalformativ = getProcAddress("glGetInternalformativ");
+	PROC_CAST glGetActiveAtomicCounterBufferiv = getProcAddress("glGetActiveAtomicCounterBufferiv");
+	PROC_CAST glBindImageTexture = getProcAddress("glBindImageTexture");
+	PROC_CAST glMemoryBarrier = getProcAddress("glMemoryBarrier");
+	PROC_CAST glTexStorage1D = getProcAddress("glTexStorage1D");
+	PROC_CAST glTexStorage2D = getProcAddress("glTexStorage2D");
+	PROC_CAST glTexStorage3D = getProcAddress("glTexStorage3D");
+	PROC_CAST glDrawTransformFeedbackInstanced = getProcAddress("glDrawTransformFeedbackInstanced");
+	PROC_CAST glDrawTransformFeedbackStreamInstanced = getProcAddress("glDrawTransformFeedbackStreamInstanced");
+	PROC_CAST glClearBufferData = getProcAddress("glClearBufferData");
+	PROC_CAST glClearBufferSubData = getProcAddress("glClearBufferSubData");
+	PROC_CAST glDispatchCompute = getProcAddress("glDispatchCompute");
+	PROC_CAST glDispatchComputeIndirect = getProcAddress("glDispatchComputeIndirect");
+	PROC_CAST glCopyImageSubData = getProcAddress("glCopyImageSubData");
+	PROC_CAST glFramebufferParameteri = getProcAddress("glFramebufferParameteri");
+	PROC_CAST glGetFramebufferParameteriv = getProcAddress("glGetFramebufferParameteriv");
+	PROC_CAST glGetInternalformati64v = getProcAddress("glGetInternalformati64v");
+	PROC_CAST glInvalidateTexSubImage = getProcAddress("glInvalidateTexSubImage");
+	PROC_CAST glInvalidateTexImage = getProcAddress("glInvalidateTexImage");
+	PROC_CAST glInvalidateBufferSubData = getProcAddress("glInvalidateBufferSubData");
+	PROC_CAST glInvalidateBufferData = getProcAddress("glInvalidateBufferData");
+	PROC_CAST glInvalidateFramebuffer = getProcAddress("glInvalidateFramebuffer");
+	PROC_CAST glInvalidateSubFramebuffer = getProcAddress("glInvalidateSubFramebuffer");
+	PROC_CAST glMultiDrawArraysIndirect = getProcAddress("glMultiDrawArraysIndirect");
+	PROC_CAST glMultiDrawElementsIndirect = getProcAddress("glMultiDrawElementsIndirect");
+	PROC_CAST glGetProgramInterfaceiv = getProcAddress("glGetProgramInterfaceiv");
+	PROC_CAST glGetProgramResourceIndex = getProcAddress("glGetProgramResourceIndex");
+	PROC_CAST glGetProgramResourceName = getProcAddress("glGetProgramResourceName");
+	PROC_CAST glGetProgramResourceiv = getProcAddress("glGetProgramResourceiv");
+	PROC_CAST glGetProgramResourceLocation = getProcAddress("glGetProgramResourceLocation");
+	PROC_CAST glGetProgramResourceLocationIndex = getProcAddress("glGetProgramResourceLocationIndex");
+	PROC_CAST glShaderStorageBlockBinding = getProcAddress("glShaderStorageBlockBinding");
+	PROC_CAST glTexBufferRange = getProcAddress("glTexBufferRange");
+	PROC_CAST glTexStorage2DMultisample = getProcAddress("glTexStorage2DMultisample");
+	PROC_CAST glTexStorage3DMultisample = getProcAddress("glTexStorage3DMultisample");
+	PROC_CAST glTextureView = getProcAddress("glTextureView");
+	PROC_CAST glBindVertexBuffer = getProcAddress("glBindVertexBuffer");
+	PROC_CAST glVertexAttribFormat = getProcAddress("glVertexAttribFormat");
+	PROC_CAST glVertexAttribIFormat = getProcAddress("glVertexAttribIFormat");
+	PROC_CAST glVertexAttribLFormat = getProcAddress("glVertexAttribLFormat");
+	PROC_CAST glVertexAttribBinding = getProcAddress("glVertexAttribBinding");
+	PROC_CAST glVertexBindingDivisor = getProcAddress("glVertexBindingDivisor");
+	PROC_CAST glDebugMessageControl = getProcAddress("glDebugMessageControl");
+	PROC_CAST glDebugMessageInsert = getProcAddress("glDebugMessageInsert");
+	PROC_CAST glDebugMessageCallback = getProcAddress("glDebugMessageCallback");
+	PROC_CAST glGetDebugMessageLog = getProcAddress("glGetDebugMessageLog");
+	PROC_CAST glPushDebugGroup = getProcAddress("glPushDebugGroup");
+	PROC_CAST glPopDebugGroup = getProcAddress("glPopDebugGroup");
+	PROC_CAST glObjectLabel = getProcAddress("glObjectLabel");
+	PROC_CAST glGetObjectLabel = getProcAddress("glGetObjectLabel");
+	PROC_CAST glObjectPtrLabel = getProcAddress("glObjectPtrLabel");
+	PROC_CAST glGetObjectPtrLabel = getProcAddress("glGetObjectPtrLabel");
+	PROC_CAST glBufferStorage = getProcAddress("glBufferStorage");
+	PROC_CAST glClearTexImage = getProcAddress("glClearTexImage");
+	PROC_CAST glClearTexSubImage = getProcAddress("glClearTexSubImage");
+	PROC_CAST glBindBuffersBase = getProcAddress("glBindBuffersBase");
+	PROC_CAST glBindBuffersRange = getProcAddress("glBindBuffersRange");
+	PROC_CAST glBindTextures = getProcAddress("glBindTextures");
+	PROC_CAST glBindSamplers = getProcAddress("glBindSamplers");
+	PROC_CAST glBindImageTextures = getProcAddress("glBindImageTextures");
+	PROC_CAST glBindVertexBuffers = getProcAddress("glBindVertexBuffers");
+	PROC_CAST glClipControl = getProcAddress("glClipControl");
+	PROC_CAST glCreateTransformFeedbacks = getProcAddress("glCreateTransformFeedbacks");
+	PROC_CAST glTransformFeedbackBufferBase = getProcAddress("glTransformFeedbackBufferBase");
+	PROC_CAST glTransformFeedbackBufferRange = getProcAddress("glTransformFeedbackBufferRange");
+	PROC_CAST glGetTransformFeedbackiv = getProcAddress("glGetTransformFeedbackiv");
+	PROC_CAST glGetTransformFeedbacki_v = getProcAddress("glGetTransformFeedbacki_v");
+	PROC_CAST glGetTransformFeedbacki64_v = getProcAddress("glGetTransformFeedbacki64_v");
+	PROC_CAST glCreateBuffers = getProcAddress("glCreateBuffers");
+	PROC_CAST glNamedBufferStorage = getProcAddress("glNamedBufferStorage");
+	PROC_CAST glNamedBufferData = getProcAddress("glNamedBufferData");
+	PROC_CAST glNamedBufferSubData = getProcAddress("glNamedBufferSubData");
+	PROC_CAST glCopyNamedBufferSubData = getProcAddress("glCopyNamedBufferSubData");
+	PROC_CAST glClearNamedBufferData = getProcAddress("glClearNamedBufferData");
+	PROC_CAST glClearNamedBufferSubData = getProcAddress("glClearNamedBufferSubData");
+	PROC_CAST glMapNamedBuffer = getProcAddress("glMapNamedBuffer");
+	PROC_CAST glMapNamedBufferRange = getProcAddress("glMapNamedBufferRange");
+	PROC_CAST glUnmapNamedBuffer = getProcAddress("glUnmapNamedBuffer");
+	PROC_CAST glFlushMappedNamedBufferRange = getProcAddress("glFlushMappedNamedBufferRange");
+	PROC_CAST glGetNamedBufferParameteriv = getProcAddress("glGetNamedBufferParameteriv");
+	PROC_CAST glGetNamedBufferParameteri64v = getProcAddress("glGetNamedBufferParameteri64v");
+	PROC_CAST glGetNamedBufferPointerv = getProcAddress("glGetNamedBufferPointerv");
+	PROC_CAST glGetNamedBufferSubData = getProcAddress("glGetNamedBufferSubData");
+	PROC_CAST glCreateFramebuffers = getProcAddress("glCreateFramebuffers");
+	PROC_CAST glNamedFramebufferRenderbuffer = getProcAddress("glNamedFramebufferRenderbuffer");
+	PROC_CAST glNamedFramebufferParameteri = getProcAddress("glNamedFramebufferParameteri");
+	PROC_CAST glNamedFramebufferTexture = getProcAddress("glNamedFramebufferTexture");
+	PROC_CAST glNamedFramebufferTextureLayer = getProcAddress("glNamedFramebufferTextureLayer");
+	PROC_CAST glNamedFramebufferDrawBuffer = getProcAddress("glNamedFramebufferDrawBuffer");
+	PROC_CAST glNamedFramebufferDrawBuffers = getProcAddress("glNamedFramebufferDrawBuffers");
+	PROC_CAST glNamedFramebufferReadBuffer = getProcAddress("glNamedFramebufferReadBuffer");
+	PROC_CAST glInvalidateNamedFramebufferData = getProcAddress("glInvalidateNamedFramebufferData");
+	PROC_CAST glInvalidateNamedFramebufferSubData = getProcAddress("glInvalidateNamedFramebufferSubData");
+	PROC_CAST glClearNamedFramebufferiv = getProcAddress("glClearNamedFramebufferiv");
+	PROC_CAST glClearNamedFramebufferuiv = getProcAddress("glClearNamedFramebufferuiv");
+	PROC_CAST glClearNamedFramebufferfv = getProcAddress("glClearNamedFramebufferfv");
+	PROC_CAST glClearNamedFramebufferfi = getProcAddress("glClearNamedFramebufferfi");
+	PROC_CAST glBlitNamedFramebuffer = getProcAddress("glBlitNamedFramebuffer");
+	PROC_CAST glCheckNamedFramebufferStatus = getProcAddress("glCheckNamedFramebufferStatus");
+	PROC_CAST glGetNamedFramebufferParameteriv = getProcAddress("glGetNamedFramebufferParameteriv");
+	PROC_CAST glGetNamedFramebufferAttachmentParameteriv = getProcAddress("glGetNamedFramebufferAttachmentParameteriv");
+	PROC_CAST glCreateRenderbuffers = getProcAddress("glCreateRenderbuffers");
+	PROC_CAST glNamedRenderbufferStorage = getProcAddress("glNamedRenderbufferStorage");
+	PROC_CAST glNamedRenderbufferStorageMultisample = getProcAddress("glNamedRenderbufferStorageMultisample");
+	PROC_CAST glGetNamedRenderbufferParameteriv = getProcAddress("glGetNamedRenderbufferParameteriv");
+	PROC_CAST glCreateTextures = getProcAddress("glCreateTextures");
+	PROC_CAST glTextureBuffer = getProcAddress("glTextureBuffer");
+	PROC_CAST glTextureBufferRange = getProcAddress("glTextureBufferRange");
+	PROC_CAST glTextureStorage1D = getProcAddress("glTextureStorage1D");
+	PROC_CAST glTextureStorage2D = getProcAddress("glTextureStorage2D");
+	PROC_CAST glTextureStorage3D = getProcAddress("glTextureStorage3D");
+	PROC_CAST glTextureStorage2DMultisample = getProcAddress("glTextureStorage2DMultisample");
+	PROC_CAST glTextureStorage3DMultisample = getProcAddress("glTextureStorage3DMultisample");
+	PROC_CAST glTextureSubImage1D = getProcAddress("glTextureSubImage1D");
+	PROC_CAST glTextureSubImage2D = getProcAddress("glTextureSubImage2D");
+	PROC_CAST glTextureSubImage3D = getProcAddress("glTextureSubImage3D");
+	PROC_CAST glCompressedTextureSubImage1D = getProcAddress("glCompressedTextureSubImage1D");
+	PROC_CAST glCompressedTextureSubImage2D = getProcAddress("glCompressedTextureSubImage2D");
+	PROC_CAST glCompressedTextureSubImage3D = getProcAddress("glCompressedTextureSubImage3D");
+	PROC_CAST glCopyTextureSubImage1D = getProcAddress("glCopyTextureSubImage1D");
+	PROC_CAST glCopyTextureSubImage2D = getProcAddress("glCopyTextureSubImage2D");
+	PROC_CAST glCopyTextureSubImage3D = getProcAddress("glCopyTextureSubImage3D");
+	PROC_CAST glTextureParameterf = getProcAddress("glTextureParameterf");
+	PROC_CAST glTextureParameterfv = getProcAddress("glTextureParameterfv");
+	PROC_CAST glTextureParameteri = getProcAddress("glTextureParameteri");
+	PROC_CAST glTextureParameterIiv = getProcAddress("glTextureParameterIiv");
+	PROC_CAST glTextureParameterIuiv = getProcAddress("glTextureParameterIuiv");
+	PROC_CAST glTextureParameteriv = getProcAddress("glTextureParameteriv");
+	PROC_CAST glGenerateTextureMipmap = getProcAddress("glGenerateTextureMipmap");
+	PROC_CAST glBindTextureUnit = getProcAddress("glBindTextureUnit");
+	PROC_CAST glGetTextureImage = getProcAddress("glGetTextureImage");
+	PROC_CAST glGetCompressedTextureImage = getProcAddress("glGetCompressedTextureImage");
+	PROC_CAST glGetTextureLevelParameterfv = getProcAddress("glGetTextureLevelParameterfv");
+	PROC_CAST glGetTextureLevelParameteriv = getProcAddress("glGetTextureLevelParameteriv");
+	PROC_CAST glGetTextureParameterfv = getProcAddress("glGetTextureParameterfv");
+	PROC_CAST glGetTextureParameterIiv = getProcAddress("glGetTextureParameterIiv");
+	PROC_CAST glGetTextureParameterIuiv = getProcAddress("glGetTextureParameterIuiv");
+	PROC_CAST glGetTextureParameteriv = getProcAddress("glGetTextureParameteriv");
+	PROC_CAST glCreateVertexArrays = getProcAddress("glCreateVertexArrays");
+	PROC_CAST glDisableVertexArrayAttrib = getProcAddress("glDisableVertexArrayAttrib");
+	PROC_CAST glEnableVertexArrayAttrib = getProcAddress("glEnableVertexArrayAttrib");
+	PROC_CAST glVertexArrayElementBuffer = getProcAddress("glVertexArrayElementBuffer");
+	PROC_CAST glVertexArrayVertexBuffer = getProcAddress("glVertexArrayVertexBuffer");
+	PROC_CAST glVertexArrayVertexBuffers = getProcAddress("glVertexArrayVertexBuffers");
+	PROC_CAST glVertexArrayAttribBinding = getProcAddress("glVertexArrayAttribBinding");
+	PROC_CAST glVertexArrayAttribFormat = getProcAddress("glVertexArrayAttribFormat");
+	PROC_CAST glVertexArrayAttribIFormat = getProcAddress("glVertexArrayAttribIFormat");
+	PROC_CAST glVertexArrayAttribLFormat = getProcAddress("glVertexArrayAttribLFormat");
+	PROC_CAST glVertexArrayBindingDivisor = getProcAddress("glVertexArrayBindingDivisor");
+	PROC_CAST glGetVertexArrayiv = getProcAddress("glGetVertexArrayiv");
+	PROC_CAST glGetVertexArrayIndexediv = getProcAddress("glGetVertexArrayIndexediv");
+	PROC_CAST glGetVertexArrayIndexed64iv = getProcAddress("glGetVertexArrayIndexed64iv");
+	PROC_CAST glCreateSamplers = getProcAddress("glCreateSamplers");
+	PROC_CAST glCreateProgramPipelines = getProcAddress("glCreateProgramPipelines");
+	PROC_CAST glCreateQueries = getProcAddress("glCreateQueries");
+	PROC_CAST glGetQueryBufferObjecti64v = getProcAddress("glGetQueryBufferObjecti64v");
+	PROC_CAST glGetQueryBufferObjectiv = getProcAddress("glGetQueryBufferObjectiv");
+	PROC_CAST glGetQueryBufferObjectui64v = getProcAddress("glGetQueryBufferObjectui64v");
+	PROC_CAST glGetQueryBufferObjectuiv = getProcAddress("glGetQueryBufferObjectuiv");
+	PROC_CAST glMemoryBarrierByRegion = getProcAddress("glMemoryBarrierByRegion");
+	PROC_CAST glGetTextureSubImage = getProcAddress("glGetTextureSubImage");
+	PROC_CAST glGetCompressedTextureSubImage = getProcAddress("glGetCompressedTextureSubImage");
+	PROC_CAST glGetGraphicsResetStatus = getProcAddress("glGetGraphicsResetStatus");
+	PROC_CAST glGetnCompressedTexImage = getProcAddress("glGetnCompressedTexImage");
+	PROC_CAST glGetnTexImage = getProcAddress("glGetnTexImage");
+	PROC_CAST glGetnUniformdv = getProcAddress("glGetnUniformdv");
+	PROC_CAST glGetnUniformfv = getProcAddress("glGetnUniformfv");
+	PROC_CAST glGetnUniformiv = getProcAddress("glGetnUniformiv");
+	PROC_CAST glGetnUniformuiv = getProcAddress("glGetnUniformuiv");
+	PROC_CAST glReadnPixels = getProcAddress("glReadnPixels");
+	PROC_CAST glTextureBarrier = getProcAddress("glTextureBarrier");
+	PROC_CAST glGetTextureHandleARB = getProcAddress("glGetTextureHandleARB");
+	PROC_CAST glGetTextureSamplerHandleARB = getProcAddress("glGetTextureSamplerHandleARB");
+	PROC_CAST glMakeTextureHandleResidentARB = getProcAddress("glMakeTextureHandleResidentARB");
+	PROC_CAST glMakeTextureHandleNonResidentARB = getProcAddress("glMakeTextureHandleNonResidentARB");
+	PROC_CAST glGetImageHandleARB = getProcAddress("glGetImageHandleARB");
+	PROC_CAST glMakeImageHandleResidentARB = getProcAddress("glMakeImageHandleResidentARB");
+	PROC_CAST glMakeImageHandleNonResidentARB = getProcAddress("glMakeImageHandleNonResidentARB");
+	PROC_CAST glUniformHandleui64ARB = getProcAddress("glUniformHandleui64ARB");
+	PROC_CAST glUniformHandleui64vARB = getProcAddress("glUniformHandleui64vARB");
+	PROC_CAST glProgramUniformHandleui64ARB = getProcAddress("glProgramUniformHandleui64ARB");
+	PROC_CAST glProgramUniformHandleui64vARB = getProcAddress("glProgramUniformHandleui64vARB");
+	PROC_CAST glIsTextureHandleResidentARB = getProcAddress("glIsTextureHandleResidentARB");
+	PROC_CAST glIsImageHandleResidentARB = getProcAddress("glIsImageHandleResidentARB");
+	PROC_CAST glVertexAttribL1ui64ARB = getProcAddress("glVertexAttribL1ui64ARB");
+	PROC_CAST glVertexAttribL1ui64vARB = getProcAddress("glVertexAttribL1ui64vARB");
+	PROC_CAST glGetVertexAttribLui64vARB = getProcAddress("glGetVertexAttribLui64vARB");
+	PROC_CAST glCreateSyncFromCLeventARB = getProcAddress("glCreateSyncFromCLeventARB");
+	PROC_CAST glDispatchComputeGroupSizeARB = getProcAddress("glDispatchComputeGroupSizeARB");
+	PROC_CAST glDebugMessageControlARB = getProcAddress("glDebugMessageControlARB");
+	PROC_CAST glDebugMessageInsertARB = getProcAddress("glDebugMessageInsertARB");
+	PROC_CAST glDebugMessageCallbackARB = getProcAddress("glDebugMessageCallbackARB");
+	PROC_CAST glGetDebugMessageLogARB = getProcAddress("glGetDebugMessageLogARB");
+	PROC_CAST glBlendEquationiARB = getProcAddress("glBlendEquationiARB");
+	PROC_CAST glBlendEquationSeparateiARB = getProcAddress("glBlendEquationSeparateiARB");
+	PROC_CAST glBlendFunciARB = getProcAddress("glBlendFunciARB");
+	PROC_CAST glBlendFuncSeparateiARB = getProcAddress("glBlendFuncSeparateiARB");
+	PROC_CAST glMultiDrawArraysIndirectCountARB = getProcAddress("glMultiDrawArraysIndirectCountARB");
+	PROC_CAST glMultiDrawElementsIndirectCountARB = getProcAddress("glMultiDrawElementsIndirectCountARB");
+	PROC_CAST glGetGraphicsResetStatusARB = getProcAddress("glGetGraphicsResetStatusARB");
+	PROC_CAST glGetnTexImageARB = getProcAddress("glGetnTexImageARB");
+	PROC_CAST glReadnPixelsARB = getProcAddress("glReadnPixelsARB");
+	PROC_CAST glGetnCompressedTexImageARB = getProcAddress("glGetnCompressedTexImageARB");
+	PROC_CAST glGetnUniformfvARB = getProcAddress("glGetnUniformfvARB");
+	PROC_CAST glGetnUniformivARB = getProcAddress("glGetnUniformivARB");
+	PROC_CAST glGetnUniformuivARB = getProcAddress("glGetnUniformuivARB");
+	PROC_CAST glGetnUniformdvARB = getProcAddress("glGetnUniformdvARB");
+	PROC_CAST glMinSampleShadingARB = getProcAddress("glMinSampleShadingARB");
+	PROC_CAST glNamedStringARB = getProcAddress("glNamedStringARB");
+	PROC_CAST glDeleteNamedStringARB = getProcAddress("glDeleteNamedStringARB");
+	PROC_CAST glCompileShaderIncludeARB = getProcAddress("glCompileShaderIncludeARB");
+	PROC_CAST glIsNamedStringARB = getProcAddress("glIsNamedStringARB");
+	PROC_CAST glGetNamedStringARB = getProcAddress("glGetNamedStringARB");
+	PROC_CAST glGetNamedStringivARB = getProcAddress("glGetNamedStringivARB");
+	PROC_CAST glBufferPageCommitmentARB = getProcAddress("glBufferPageCommitmentARB");
+	PROC_CAST glNamedBufferPageCommitmentEXT = getProcAddress("glNamedBufferPageCommitmentEXT");
+	PROC_CAST glNamedBufferPageCommitmentARB = getProcAddress("glNamedBufferPageCommitmentARB");
+	PROC_CAST glTexPageCommitmentARB = getProcAddress("glTexPageCommitmentARB");
 }
\ No newline at end of file
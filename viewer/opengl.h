@@ -5,6 +5,9 @@
 // Call this once after creating your OpenGL context to load the GL functions from the GL driver.
 void OpenGL_Init();
 
+// Same, but loads the GL functions with the given function instead of SDL's. (eg. eglGetProcAddress, for a context that wasn't created by SDL)
+void OpenGL_Init(void* (*getProcAddress)(const char* proc));
+
 // Derived from Khronos' glcorearb.h, which was distributed under the following license:
 /*
 ** Copyright (c) 2013-2016 The Khronos Group Inc.
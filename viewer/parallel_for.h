@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The threads ParallelFor() spreads its jobs over, besides the calling thread.
+// They're started once and kept for the lifetime of the process, since starting them on every call
+// costs more than the smaller parallel loops (a few rows of the CPU SAT) take to run.
+class ParallelForPool
+{
+    std::vector<std::thread> mThreads;
+    std::mutex mMutex;
+    std::condition_variable mWorkCondition;
+    std::condition_variable mDoneCondition;
+    // Held for a whole Run(), so runs from different threads take turns.
+    std::mutex mRunMutex;
+
+    bool mQuit;
+    // Incremented by every Run(), so each thread joins every run exactly once.
+    uint64_t mRunIndex;
+    // The number of threads that haven't finished the current run yet.
+    int mPendingThreadCount;
+
+    // The current run. The jobs are grabbed from mNextJob by all the threads.
+    void (*mRunJob)(const void* func, int job);
+    const void* mFunc;
+    int mJobCount;
+    std::atomic<int> mNextJob;
+
+    // Whether the calling thread is running a job, so a nested ParallelFor() runs inline instead of waiting on itself.
+    static bool& IsInJob()
+    {
+        static thread_local bool inJob = false;
+        return inJob;
+    }
+
+    void RunJobs()
+    {
+        IsInJob() = true;
+        for (int job = mNextJob++; job < mJobCount; job = mNextJob++)
+        {
+            mRunJob(mFunc, job);
+        }
+        IsInJob() = false;
+    }
+
+    void ThreadMain()
+    {
+        uint64_t lastRunIndex = 0;
+        std::unique_lock<std::mutex> lock(mMutex);
+        for (;;)
+        {
+            mWorkCondition.wait(lock, [&] { return mQuit || mRunIndex != lastRunIndex; });
+            if (mQuit)
+            {
+                return;
+            }
+            lastRunIndex = mRunIndex;
+
+            lock.unlock();
+            RunJobs();
+            lock.lock();
+
+            if (--mPendingThreadCount == 0)
+            {
+                mDoneCondition.notify_one();
+            }
+        }
+    }
+
+public:
+    // Starts hardware_concurrency() - 1 threads.
+    ParallelForPool()
+        : mQuit(false)
+        , mRunIndex(0)
+        , mPendingThreadCount(0)
+        , mRunJob(nullptr)
+        , mFunc(nullptr)
+        , mJobCount(0)
+        , mNextJob(0)
+    {
+        int threadCount = std::max(1, (int)std::thread::hardware_concurrency()) - 1;
+        for (int i = 0; i < threadCount; i++)
+        {
+            mThreads.emplace_back([this] { ThreadMain(); });
+        }
+    }
+
+    // Stops the threads. Must not be called during a Run().
+    ~ParallelForPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mQuit = true;
+        }
+        mWorkCondition.notify_all();
+
+        for (std::thread& thread : mThreads)
+        {
+            thread.join();
+        }
+    }
+
+    ParallelForPool(const ParallelForPool&) = delete;
+    ParallelForPool& operator=(const ParallelForPool&) = delete;
+
+    // Runs runJob(func, jobIndex) for every job in [0, jobCount) on the threads of the pool and the calling thread,
+    // and returns once they're all done.
+    void Run(int jobCount, void (*runJob)(const void* func, int job), const void* func)
+    {
+        if (IsInJob() || mThreads.empty() || jobCount <= 1)
+        {
+            for (int job = 0; job < jobCount; job++)
+            {
+                runJob(func, job);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> runLock(mRunMutex);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRunJob = runJob;
+            mFunc = func;
+            mJobCount = jobCount;
+            mNextJob = 0;
+            mPendingThreadCount = (int)mThreads.size();
+            mRunIndex++;
+        }
+        mWorkCondition.notify_all();
+
+        RunJobs();
+
+        // every thread has to be done with the run before func goes out of scope
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDoneCondition.wait(lock, [&] { return mPendingThreadCount == 0; });
+    }
+};
+
+// The pool shared by every ParallelFor(). Started by the first call.
+inline ParallelForPool& GetParallelForPool()
+{
+    static ParallelForPool pool;
+    return pool;
+}
+
+// Runs func(jobIndex) for every job in [0, jobCount), spread over all hardware threads.
+// The calling thread participates in the work too. (see ParallelForPool)
+template<class Func>
+inline void ParallelFor(int jobCount, const Func& func)
+{
+    auto runJob = [](const void* f, int job)
+    {
+        (*(const Func*)f)(job);
+    };
+
+    GetParallelForPool().Run(jobCount, runJob, &func);
+}
\ No newline at end of file
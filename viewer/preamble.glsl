@@ -4,6 +4,10 @@
 // Blit
 #define BLIT_TEXCOORD_VARYING_LOCATION 0
 
+// Present (present.frag)
+// Draws the HDR backbuffer to the window, since blitting it wouldn't encode it to sRGB.
+#define PRESENT_COLOR_TEXTURE_BINDING 0
+
 // Scene
 #define SCENE_POSITION_ATTRIB_LOCATION 0
 #define SCENE_TEXCOORD_ATTRIB_LOCATION 1
@@ -22,11 +26,15 @@
 #define SCENE_DIFFUSE_MAP_TEXTURE_BINDING 0
 
 // SAT
+// The default workgroup sizes. GPUSAT::Init() overrides them with the ones given to it. (see SATWorkgroupSizes)
+#ifndef SAT_WORKGROUP_SIZE_X
 #define SAT_WORKGROUP_SIZE_X 1024
+#endif
 
 #define SAT_READ_UINT_INPUT_UNIFORM_LOCATION 0
 #define SAT_READ_WGSUM_UNIFORM_LOCATION 1
 #define SAT_ADD_WGSUM_UNIFORM_LOCATION 2
+#define SAT_SCAN_COLUMNS_UNIFORM_LOCATION 3
 
 #define SAT_INPUT_TEXTURE_BINDING 0
 #define SAT_UINT_INPUT_TEXTURE_BINDING 1
@@ -34,17 +42,677 @@
 #define SAT_OUTPUT_IMAGE_BINDING 0
 #define SAT_WGSUMS_IMAGE_BINDING 1
 
+// Iterated SATs: the SAT of order k is the image prefix summed k times along both axes (see GPUSAT::Resize).
+// Their sums keep growing past the image, where the taps of the higher order DoF kernels reach,
+// so they're padded past the right and top of the image with this many texels. Enough for the widest kernel. (see DOF_TENT_MAX_BLUR_RADIUS)
+#define SAT_ITERATED_PADDING 64
+
+// SAT storage formats, selected per program with SAT_FORMAT
+// RGBA32UI: one 32-bit sum per channel
+#define SAT_FORMAT_RGBA32UI 0
+// COMPACT: R, G and B packed into one 64-bit integer (R | G << 21 | B << 42), stored as RG32UI.
+// Sums wrap around modulo 2^64, but the SAT is linear so a box sum computed from 4 taps is exact
+// as long as each channel's box sum fits in its 21 bits: (2 * 44 + 1)^2 * 255 < 2^21.
+#define SAT_FORMAT_COMPACT 1
+#define SAT_COMPACT_MAX_BLUR_RADIUS 44
+// HDR: the inclusive SAT of a linear float image (the RGBA16F scene), without alpha. Stored as float bits in RGBA32UI.
+// A float SAT of the whole image would lose the low bits of its sums as they grow, and those are what's left of a box sum.
+// So each element is split in 4 parts, relative to the SAT_HDR_TILE_SIZE x SAT_HDR_TILE_SIZE tile it's in, at (x0,y0):
+// - the sum of the tile up to the element: [x0,x]x[y0,y], in the RGB of its texel.
+// - the sum of the columns below it: [x0,x]x[0,y0), one per column of the tile.
+// - the sum of the rows left of it: [0,x0)x[y0,y], one per row of the tile.
+// - the sum of everything below and left of the tile: [0,x0)x[0,y0), one per tile.
+// Only the first part is a float, which doesn't grow past the size of the tile. The others are float-float (a high float plus
+// a low float that holds its rounding error), which keeps enough bits for them to cancel out between the taps of a box.
+// They're kept in the alpha channels of the tile's texels, so it's no bigger than the RGBA32UI SAT. (see sat_hdr_box_sum)
+#define SAT_FORMAT_HDR 2
+#define SAT_HDR_TILE_SIZE 16
+
+// The float-float values of a tile are in 32-bit slots, 6 per RGB value (the high then low float of each channel):
+// one for each column, then for each row, then for the corner. Slot i is the alpha of texel (i % (SAT_HDR_TILE_SIZE - 1), i / (SAT_HDR_TILE_SIZE - 1)) of the tile,
+// which leaves the last row and column of the tile to the sums the slots are computed from. (see sat_hdr_offsets.comp)
+#define SAT_HDR_COLUMN_SLOT 0
+#define SAT_HDR_ROW_SLOT (6 * SAT_HDR_TILE_SIZE)
+#define SAT_HDR_CORNER_SLOT (12 * SAT_HDR_TILE_SIZE)
+
+#ifndef __cplusplus
+#ifndef SAT_FORMAT
+#define SAT_FORMAT SAT_FORMAT_RGBA32UI
+#endif
+
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+#define SAT_IMAGE_FORMAT rg32ui
+#define SAT_TYPE uvec2
+#elif SAT_FORMAT == SAT_FORMAT_HDR
+// no SAT_TYPE, the elements are only summed from their parts in a whole box (see sat_hdr_box_sum)
+#define SAT_IMAGE_FORMAT rgba32ui
+#else
+#define SAT_IMAGE_FORMAT rgba32ui
+#define SAT_TYPE uvec4
+#endif
+
+// The HDR SAT isn't scanned (see sat_hdr_tiles.comp), so it has no packing, limbs nor padding.
+#if SAT_FORMAT != SAT_FORMAT_HDR
+// converts per-channel values (each less than 2^21) to a SAT element
+SAT_TYPE sat_pack(uvec4 v)
+{
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    return uvec2(v.r | (v.g << 21), (v.g >> 11) | (v.b << 10));
+#else
+    return v;
+#endif
+}
+
+// converts a SAT element (or a difference of SAT elements) back to per-channel values
+// alpha isn't stored by the compact format, so it's returned as 0.
+uvec4 sat_unpack(SAT_TYPE v)
+{
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    return uvec4(v.x & 0x1FFFFFu, (v.x >> 21) | ((v.y & 0x3FFu) << 11), v.y >> 10, 0u);
+#else
+    return v;
+#endif
+}
+
+SAT_TYPE sat_add(SAT_TYPE a, SAT_TYPE b)
+{
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    uint carry;
+    uint lo = uaddCarry(a.x, b.x, carry);
+    return uvec2(lo, a.y + b.y + carry);
+#else
+    return a + b;
+#endif
+}
+
+SAT_TYPE sat_sub(SAT_TYPE a, SAT_TYPE b)
+{
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    uint borrow;
+    uint lo = usubBorrow(a.x, b.x, borrow);
+    return uvec2(lo, a.y - b.y - borrow);
+#else
+    return a - b;
+#endif
+}
+
+// conversions between SAT elements and the texels read and written by images and samplers
+SAT_TYPE sat_from_texel(uvec4 texel)
+{
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    return texel.xy;
+#else
+    return texel;
+#endif
+}
+
+uvec4 sat_to_texel(SAT_TYPE v)
+{
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    return uvec4(v, 0u, 0u);
+#else
+    return v;
+#endif
+}
+
+// Subgroup arithmetic adds 32-bit lanes without carrying between them.
+// So the elements are split into 16-bit limbs, which don't overflow when summed over a workgroup,
+// and the limbs are recombined with carries after the sum.
+uvec4 sat_to_limbs(SAT_TYPE v)
+{
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    return uvec4(v.x & 0xFFFFu, v.x >> 16, v.y & 0xFFFFu, v.y >> 16);
+#else
+    return v;
+#endif
+}
+
+SAT_TYPE sat_from_limbs(uvec4 limbs)
+{
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    // limbs.x + limbs.y * 2^16 + limbs.z * 2^32 + limbs.w * 2^48
+    SAT_TYPE low = sat_add(uvec2(limbs.x, 0u), uvec2(limbs.y << 16, limbs.y >> 16));
+    return sat_add(low, uvec2(0u, limbs.z + (limbs.w << 16)));
+#else
+    return limbs;
+#endif
+}
+
+#ifdef SAT_SUBGROUPS
+// Compiled with GL_KHR_shader_subgroup_arithmetic enabled. (see GPUSAT::Init)
+SAT_TYPE sat_subgroup_add(SAT_TYPE v)
+{
+    return sat_from_limbs(subgroupAdd(sat_to_limbs(v)));
+}
+
+SAT_TYPE sat_subgroup_inclusive_add(SAT_TYPE v)
+{
+    return sat_from_limbs(subgroupInclusiveAdd(sat_to_limbs(v)));
+}
+#endif
+
+// The padded scans (sat_up_padded.comp, sat_down_padded.comp) keep the tree in a single shared buffer,
+// with an unused element after every SAT_SCAN_PADDING_INTERVAL elements. The up/down-sweep reads elements
+// a power of two apart, which would otherwise map to the same banks (32 banks of 4 bytes).
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+#define SAT_SCAN_PADDING_INTERVAL 16u
+#else
+#define SAT_SCAN_PADDING_INTERVAL 8u
+#endif
+
+#define SAT_SCAN_PADDED_SIZE(n) ((n) + (n) / SAT_SCAN_PADDING_INTERVAL)
+
+uint sat_scan_padded_index(uint i)
+{
+    return i + i / SAT_SCAN_PADDING_INTERVAL;
+}
+#endif
+
+// The scans work on rows, with element i of row j at (i,j).
+// When scanning the columns in place, element i of column j is at (j,i) instead.
+ivec2 sat_scan_texel(ivec2 scan_index, int scan_columns)
+{
+    return scan_columns != 0 ? scan_index.yx : scan_index;
+}
+
+// The number of elements in each row (or column) of an image that's scanned.
+int sat_scan_length(ivec2 size, int scan_columns)
+{
+    return scan_columns != 0 ? size.y : size.x;
+}
+
+// A texel of the sRGB input image, as linear [0,255]. The padding of iterated SATs is past the input, so it reads as 0.
+uvec4 sat_input_texel(sampler2D img, ivec2 xy)
+{
+    if (any(greaterThanEqual(xy, textureSize(img, 0)))) {
+        return uvec4(0);
+    }
+    return uvec4(texelFetch(img, xy, 0) * 255.0);
+}
+
+// The texel of a tile of the HDR SAT that holds the given slot in its alpha. (see SAT_HDR_COLUMN_SLOT)
+ivec2 sat_hdr_slot_texel(ivec2 tile_origin, int slot)
+{
+    return tile_origin + ivec2(slot % (SAT_HDR_TILE_SIZE - 1), slot / (SAT_HDR_TILE_SIZE - 1));
+}
+
+#if SAT_FORMAT == SAT_FORMAT_HDR
+uint sat_hdr_slot(usampler2D sat, ivec2 tile_origin, int slot)
+{
+    return texelFetch(sat, sat_hdr_slot_texel(tile_origin, slot), 0).a;
+}
+
+// Adds the float-float value b to a. (see SAT_FORMAT_HDR)
+// The temporaries are precise, so the compiler can't simplify away the rounding errors that make up the low float.
+void sat_hdr_add(inout vec3 a_hi, inout vec3 a_lo, vec3 b_hi, vec3 b_lo)
+{
+    // the rounding error of the sum of the high floats (two-sum), plus the low floats
+    precise vec3 s = a_hi + b_hi;
+    precise vec3 b_rounded = s - a_hi;
+    precise vec3 e = (a_hi - (s - b_rounded)) + (b_hi - b_rounded) + a_lo + b_lo;
+
+    // renormalized, so the low float is below the last bit of the high one
+    precise vec3 hi = s + e;
+    precise vec3 lo = e - (hi - s);
+    a_hi = hi;
+    a_lo = lo;
+}
+
+// Adds sign times the float-float value in the slots of a tile starting at slot.
+void sat_hdr_add_slots(usampler2D sat, ivec2 tile_origin, int slot, float sign, inout vec3 sum_hi, inout vec3 sum_lo)
+{
+    vec3 hi;
+    vec3 lo;
+    for (int c = 0; c < 3; c++)
+    {
+        hi[c] = uintBitsToFloat(sat_hdr_slot(sat, tile_origin, slot + 2 * c + 0));
+        lo[c] = uintBitsToFloat(sat_hdr_slot(sat, tile_origin, slot + 2 * c + 1));
+    }
+    sat_hdr_add(sum_hi, sum_lo, sign * hi, sign * lo);
+}
+#endif
+#endif // __cplusplus
+
+// Single-pass SAT scan (decoupled look-back)
+// Reuses the SAT input/output bindings and SAT_READ_UINT_INPUT_UNIFORM_LOCATION.
+#define SAT_SCAN_FLAGS_BUFFER_BINDING 0
+#define SAT_SCAN_SUMS_BUFFER_BINDING 1
+
+// The state of a chunk of a row, as seen by the chunks after it.
+#define SAT_SCAN_FLAG_NOT_READY 0
+#define SAT_SCAN_FLAG_AGGREGATE 1 // the sum of the chunk is available
+#define SAT_SCAN_FLAG_PREFIX 2 // the sum of the row up to and including the chunk is available
+
 // Transpose SAT
+#ifndef TRANSPOSE_SAT_WORKGROUP_SIZE_X
 #define TRANSPOSE_SAT_WORKGROUP_SIZE_X 32
+#endif
 
 #define TRANSPOSE_SAT_INPUT_IMAGE_BINDING 0
 #define TRANSPOSE_SAT_OUTPUT_IMAGE_BINDING 1
 
+// HDR SAT (sat_hdr_tiles.comp, sat_hdr_offsets.comp)
+// Reuses SAT_INPUT_TEXTURE_BINDING and SAT_OUTPUT_IMAGE_BINDING.
+// A workgroup per tile sums it, then an invocation per column and row of the image sums the tiles below and left of it,
+// then an invocation per column of tiles sums their corners. (see GPUSAT::ComputeHDR)
+#define SAT_HDR_OFFSETS_WORKGROUP_SIZE_X 64
+
+#define SAT_HDR_CORNERS_UNIFORM_LOCATION 0
+
+// Downsample SAT input (for the coarser levels of the SAT pyramid)
+// Reuses SAT_INPUT_TEXTURE_BINDING and SAT_OUTPUT_IMAGE_BINDING.
+#define SAT_DOWNSAMPLE_WORKGROUP_SIZE_X 16
+
+#define SAT_DOWNSAMPLE_LEVEL_UNIFORM_LOCATION 4
+
 // DOF
 #define DOF_ZNEAR_UNIFORM_LOCATION 0
 #define DOF_FOCUS_UNIFORM_LOCATION 1
+#define DOF_SAT_LEVELS_UNIFORM_LOCATION 2
+// Whether the SAT is inclusive (the CPU and HDR SATs) or exclusive (the GPU SAT). The pyramid levels are always exclusive.
+#define DOF_SAT_INCLUSIVE_UNIFORM_LOCATION 3
 
 #define DOF_SAT_TEXTURE_BINDING 0
 #define DOF_DEPTH_TEXTURE_BINDING 1
+#define DOF_HALF_SAT_TEXTURE_BINDING 2
+#define DOF_QUARTER_SAT_TEXTURE_BINDING 3
+
+// The SAT pyramid: level i is the SAT of the image downsampled by 2^i (full, half and quarter resolution).
+// DOF_SAT_LEVELS_UNIFORM_LOCATION is a mask of the levels that were built.
+#define DOF_SAT_LEVEL_COUNT 3
+// A level is used for blur radii of at least this many of its texels, if it was built.
+#define DOF_SAT_LEVEL_MIN_RADIUS 4
+
+// DOF tiles
+// dof_tiles.comp classifies each DOF_TILE_SIZE x DOF_TILE_SIZE tile of the image by the blur radii of its pixels,
+// and the DoF is drawn one class at a time, as a quad per tile. (see DoFTiles)
+// Reuses DOF_DEPTH_TEXTURE_BINDING, DOF_ZNEAR_UNIFORM_LOCATION and DOF_FOCUS_UNIFORM_LOCATION.
+#define DOF_TILE_SIZE 16
+
+// every pixel is in focus (radius 0) or background, so the tile is left as it is.
+#define DOF_TILE_CLASS_IN_FOCUS 0
+// every pixel has the same radius, so the radius is read once per tile rather than from the depth of each pixel.
+#define DOF_TILE_CLASS_UNIFORM 1
+// anything else, blurred per pixel like the fullscreen DoF.
+#define DOF_TILE_CLASS_MIXED 2
+// a uniform tile with a radius small enough for dof_separable.comp, when it's asked for. (see DOF_TILE_SEPARABLE_MAX_RADIUS_UNIFORM_LOCATION)
+#define DOF_TILE_CLASS_SEPARABLE 3
+#define DOF_TILE_CLASS_COUNT 4
+
+// the vertices of each tile's quad (two triangles)
+#define DOF_TILE_VERTEX_COUNT 6
+
+#define DOF_TILE_COMMANDS_BUFFER_BINDING 0
+#define DOF_TILE_LISTS_BUFFER_BINDING 1
+
+#define DOF_TILE_LISTS_TEXTURE_BINDING 4
+
+#define DOF_TILE_LIST_OFFSET_UNIFORM_LOCATION 4
+// The largest radius of the separable tiles, or 0 to classify them all as uniform.
+#define DOF_TILE_SEPARABLE_MAX_RADIUS_UNIFORM_LOCATION 6
+
+#define DOF_TILE_RADIUS_VARYING_LOCATION 0
+
+// Compute DOF (dof.comp)
+// A workgroup per tile. Reuses the DOF texture bindings and uniform locations.
+#define DOF_OUTPUT_IMAGE_BINDING 0
+
+// The width and height of the window of SAT elements cached around each corner of the boxes of a tile.
+// The window is the size of the tile in texels of its level, plus the spread of the radii of its pixels.
+// 4 windows of RGBA32UI elements fit in the 32KB of shared memory every GPU has.
+#define DOF_SAT_CACHE_SIZE 22
+
+// Separable DOF (dof_separable.comp)
+// A workgroup per separable tile, dispatched indirectly for the class. (see DoFTiles::Dispatch)
+// The tile's pixels all have the same box, so it's blurred straight from the image rather than the SAT:
+// the rows of the tile's window of 8-bit texels are turned into prefix sums in shared memory, then the boxes of the tile's columns
+// along them, so each pixel's box is a difference of prefix sums.
+// The boxes are the same as the full resolution SAT's, so the tile matches the tiles drawn by dof.frag around it
+// as long as its radius is one they blur at full resolution. (see Renderer::GetSeparableDoFMaxRadius)
+// Reuses the DOF uniform locations, DOF_OUTPUT_IMAGE_BINDING and DOF_TILE_LISTS_TEXTURE_BINDING.
+// The prefix sums of the window are kept in shared memory, which bounds the radius.
+#define DOF_SEPARABLE_MAX_BLUR_RADIUS 24
+// The image before the DoF. The tiles read the pixels around them, so they're written to another texture
+// and copied over the image once they're all done (dof_separable_copy.frag, drawn with dof_tile.vert).
+#define DOF_SEPARABLE_COLOR_TEXTURE_BINDING 7
+#define DOF_SEPARABLE_OUTPUT_TEXTURE_BINDING 8
+
+// Half resolution DOF (dof_half.frag, dof_upsample.frag)
+// dof_half.frag blurs each 2x2 block of the image with the coarse levels of the SAT, into a half resolution color and depth.
+// dof_upsample.frag then blends the blocks around each pixel that's out of focus, weighted by how close their depth is.
+// The pixels in focus keep their full resolution color. Reuses the DOF texture bindings and uniform locations.
+#define DOF_HALF_COLOR_OUTPUT_LOCATION 0
+#define DOF_HALF_DEPTH_OUTPUT_LOCATION 1
+
+#define DOF_HALF_COLOR_TEXTURE_BINDING 5
+#define DOF_HALF_DEPTH_TEXTURE_BINDING 6
+
+// Keeps the depth weights of the upsample finite for blocks at the depth of the pixel. In eye space units.
+#define DOF_UPSAMPLE_DEPTH_EPSILON 0.01
+
+// DOF kernels (dof.frag)
+// The box is blurred from the SAT. A kernel that convolves k boxes together is blurred from the iterated SAT of order k instead,
+// as the k-th difference of its taps, which is O(1) per pixel whatever the radius. (see dof_kernel_taps)
+#define DOF_KERNEL_UNIFORM_LOCATION 5
+
+#define DOF_KERNEL_BOX 0
+// 2 boxes: a tent, from 3x3 taps of the SAT of order 2.
+#define DOF_KERNEL_TENT 1
+// 3 boxes: a quadratic B-spline, from 6x6 taps of the SAT of order 3.
+#define DOF_KERNEL_QUADRATIC 2
+#define DOF_KERNEL_COUNT 3
+
+// The order of the iterated SAT the kernel is blurred from.
+#define DOF_KERNEL_ORDER(kernel) ((kernel) + 1)
+
+// The iterated SATs are RGBA32UI, and their sums wrap around modulo 2^32 like the compact SAT's.
+// The taps still add up to the exact sum under the kernel as long as it fits in 32 bits, which limits the radius:
+// 255 * (62 + 1)^4 < 2^32 for the tent, 255 * (15^2 * 17)^2 < 2^32 for the quadratic.
+#define DOF_TENT_MAX_BLUR_RADIUS 62
+#define DOF_QUADRATIC_MAX_BLUR_RADIUS 22
+
+#ifndef __cplusplus
+// The corners of the box filter, and the SAT elements tapped for them
+#define DOF_TAP_UR 0
+#define DOF_TAP_UL 1
+#define DOF_TAP_LR 2
+#define DOF_TAP_LL 3
+
+// The blur radius (in pixels) of a pixel that isn't background, from its reversed-Z depth.
+int dof_blur_radius(float depth, float znear, float focus)
+{
+    // convert to eye space depth
+    depth = znear / depth;
+
+    return int(abs(depth - focus));
+}
+
+// The level of the SAT pyramid to blur with: the coarsest that was built and still has enough texels across the box.
+// sat_levels is the mask of the levels that were built. (see DOF_SAT_LEVELS_UNIFORM_LOCATION)
+int dof_sat_level(int sat_levels, int radius)
+{
+    int level = findLSB(sat_levels);
+    for (int i = level + 1; i < DOF_SAT_LEVEL_COUNT; i++)
+    {
+        if ((sat_levels & (1 << i)) != 0 && radius >= (DOF_SAT_LEVEL_MIN_RADIUS << i)) {
+            level = i;
+        }
+    }
+    return level;
+}
+
+// The radius of the box, in texels of the level.
+int dof_sat_radius(int level, int radius)
+{
+    int s = (radius + ((1 << level) >> 1)) >> level;
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    // larger boxes would overflow the packed channels
+    s = min(s, ((2 * SAT_COMPACT_MAX_BLUR_RADIUS + 1) / (1 << level) - 1) / 2);
+#endif
+    return s;
+}
+
+// The 4 locations of the SAT that are sampled ("tapped") for a box of radius s (in texels) around the center texel.
+void dof_box_taps(ivec2 center, int s, int sat_inclusive, out ivec2 taps[4])
+{
+    // each tap is offset from the box filter differently
+    ivec2 tap_offsets[4];
+    tap_offsets[DOF_TAP_UR] = ivec2(0, 0);
+    tap_offsets[DOF_TAP_UL] = ivec2(1, 0);
+    tap_offsets[DOF_TAP_LR] = ivec2(0, 1);
+    tap_offsets[DOF_TAP_LL] = ivec2(1, 1);
+
+    taps[DOF_TAP_UR] = center + ivec2(+s, +s) - tap_offsets[DOF_TAP_UR];
+    taps[DOF_TAP_UL] = center + ivec2(-s, +s) - tap_offsets[DOF_TAP_UL];
+    taps[DOF_TAP_LR] = center + ivec2(+s, -s) - tap_offsets[DOF_TAP_LR];
+    taps[DOF_TAP_LL] = center + ivec2(-s, -s) - tap_offsets[DOF_TAP_LL];
+
+    // with an exclusive SAT, the box is a texel down-left of the center,
+    // so it's empty when clamped to the bottom-left texel with no radius. keep the texel that the box was clamped to.
+    if (sat_inclusive == 0) {
+        taps[DOF_TAP_UR] = max(taps[DOF_TAP_UR], ivec2(1));
+        taps[DOF_TAP_UL].y = max(taps[DOF_TAP_UL].y, 1);
+        taps[DOF_TAP_LR].x = max(taps[DOF_TAP_LR].x, 1);
+    }
+}
+
+// The pixels [lo, hi) of the box of radius s around p, along one axis of the image: the same pixels as the SAT's box at level 0.
+// (see dof_box_taps and dof_box_average)
+void dof_box_bounds(int p, int s, int sat_inclusive, int size, out int lo, out int hi)
+{
+    if (sat_inclusive != 0) {
+        lo = max(p - s, 0);
+        hi = min(p + s, size - 1) + 1;
+    }
+    else {
+        lo = max(p - s - 1, 0);
+        hi = min(max(p + s, 1), size);
+    }
+}
+
+// The number of elements of the SAT of a level that are tapped along each axis: one per block of the image,
+// and one more for an exclusive SAT, whose last element sums the whole row or column. (see GPUSAT::Resize)
+// The texture can be larger, e.g. the CPU SAT is uploaded into the GPU SAT's texture.
+ivec2 dof_sat_size(int level, int sat_inclusive, ivec2 image_size)
+{
+    return ((image_size + ivec2((1 << level) - 1)) >> level) + ivec2(1 - sat_inclusive);
+}
+
+// The number of pixels in the box between 4 taps of the SAT of a level.
+// Each element of the SAT of a level sums a 2^level x 2^level block of pixels, so the box is snapped to whole blocks.
+// sat_size is the size of the SAT of the level. (see dof_sat_size)
+int dof_box_pixel_count(ivec2 taps[4], int level, int sat_inclusive, ivec2 sat_size, ivec2 image_size)
+{
+    // the area of the blur might have changed from the clamping of the taps.
+    // the sum covers the blocks [LL, UR) of an exclusive SAT, or (LL, UR] of an inclusive one, clamped the same way as the taps.
+    // it's counted in pixels, since the blocks at the edges of the image are partial.
+    ivec2 box_min = max(taps[DOF_TAP_LL] + ivec2(sat_inclusive), ivec2(0)) << level;
+    ivec2 box_max = min((min(taps[DOF_TAP_UR], sat_size - ivec2(1)) + ivec2(sat_inclusive)) << level, image_size);
+    return (box_max.x - box_min.x) * (box_max.y - box_min.y);
+}
+
+#if SAT_FORMAT == SAT_FORMAT_HDR
+// The sum of the box between 4 taps of the HDR SAT, clamped like the taps of the other formats. (see dof_fetch_tap)
+// Each element is the sum of 4 parts (see SAT_FORMAT_HDR), and a part cancels out between taps that share what it depends on:
+// - the columns below the tile, between the taps in the same row of tiles.
+// - the rows left of the tile, between the taps in the same column of tiles.
+// - the corner of the tile, between the taps in the same tile, so whenever one of the above cancels.
+// Those slots aren't read, so a box within a tile reads only the floats of its 4 taps.
+// The rest is summed as float-float, which keeps the low bits that are left of the large parts after they cancel out.
+vec3 sat_hdr_box_sum(usampler2D sat, ivec2 taps[4], ivec2 sat_size)
+{
+    // the left and right taps share their x, and the bottom and top taps their y. a tap before the SAT is 0, so it cancels nothing.
+    ivec2 lo = min(taps[DOF_TAP_LL], sat_size - ivec2(1));
+    ivec2 hi = min(taps[DOF_TAP_UR], sat_size - ivec2(1));
+    bvec2 cancels = bvec2(
+        lo.x >= 0 && lo.x / SAT_HDR_TILE_SIZE == hi.x / SAT_HDR_TILE_SIZE,
+        lo.y >= 0 && lo.y / SAT_HDR_TILE_SIZE == hi.y / SAT_HDR_TILE_SIZE);
+
+    vec3 sum_hi = vec3(0.0);
+    vec3 sum_lo = vec3(0.0);
+    for (int i = 0; i < 4; i++)
+    {
+        ivec2 xy = min(taps[i], sat_size - ivec2(1));
+        if (any(lessThan(xy, ivec2(0)))) {
+            continue;
+        }
+
+        float sign = (i == DOF_TAP_UR || i == DOF_TAP_LL) ? 1.0 : -1.0;
+        ivec2 tile_origin = xy - xy % SAT_HDR_TILE_SIZE;
+        ivec2 in_tile = xy - tile_origin;
+
+        if (!cancels.x && !cancels.y) {
+            sat_hdr_add_slots(sat, tile_origin, SAT_HDR_CORNER_SLOT, sign, sum_hi, sum_lo);
+        }
+        if (!cancels.y) {
+            sat_hdr_add_slots(sat, tile_origin, SAT_HDR_COLUMN_SLOT + 6 * in_tile.x, sign, sum_hi, sum_lo);
+        }
+        if (!cancels.x) {
+            sat_hdr_add_slots(sat, tile_origin, SAT_HDR_ROW_SLOT + 6 * in_tile.y, sign, sum_hi, sum_lo);
+        }
+        sat_hdr_add(sum_hi, sum_lo, sign * uintBitsToFloat(texelFetch(sat, xy, 0).rgb), vec3(0.0));
+    }
+    return sum_hi + sum_lo;
+}
+#else
+// Samples a tap, handling out-of-bounds by clamping: 0 before the SAT, its last row/column past it.
+SAT_TYPE dof_fetch_tap(usampler2D sat, ivec2 tap, ivec2 sat_size)
+{
+    if (any(lessThan(tap, ivec2(0)))) {
+        return SAT_TYPE(0);
+    }
+    return sat_from_texel(texelFetch(sat, min(tap, sat_size - ivec2(1)), 0));
+}
+
+// The average (0-1) of the box from the SAT elements of its 4 taps. (see dof_box_pixel_count)
+vec4 dof_box_average(SAT_TYPE sat[4], ivec2 taps[4], int level, int sat_inclusive, ivec2 sat_size, ivec2 image_size)
+{
+    int boxsz = dof_box_pixel_count(taps, level, sat_inclusive, sat_size, image_size);
+
+    // perform a box filter
+    uvec4 box_sum = sat_unpack(sat_add(sat_sub(sat_sub(sat[DOF_TAP_UR], sat[DOF_TAP_UL]), sat[DOF_TAP_LR]), sat[DOF_TAP_LL]));
+#if SAT_FORMAT == SAT_FORMAT_COMPACT
+    // alpha isn't stored, so it's left opaque
+    box_sum.a = 255u * uint(boxsz);
+#endif
+    vec4 sat_box = vec4(box_sum) / float(boxsz);
+
+    return sat_box / 255.0;
+}
+#endif
+
+// Box filter of the given radius (in pixels) around pixel p, from the SAT of the image downsampled by 2^level.
+vec4 dof_sat_box_filter(usampler2D sat_level, int level, ivec2 p, int radius, int sat_inclusive, ivec2 image_size)
+{
+    ivec2 taps[4];
+    dof_box_taps(p >> level, dof_sat_radius(level, radius), sat_inclusive, taps);
+    ivec2 sat_size = dof_sat_size(level, sat_inclusive, image_size);
+
+#if SAT_FORMAT == SAT_FORMAT_HDR
+    // already linear, and alpha isn't stored so it's left opaque
+    vec3 box_sum = sat_hdr_box_sum(sat_level, taps, sat_size);
+    return vec4(box_sum / float(dof_box_pixel_count(taps, level, sat_inclusive, sat_size, image_size)), 1.0);
+#else
+    // sample the 4 corners of the SAT region
+    SAT_TYPE sat[4];
+    for (int i = 0; i < 4; i++)
+    {
+        sat[i] = dof_fetch_tap(sat_level, taps[i], sat_size);
+    }
+
+    return dof_box_average(sat, taps, level, sat_inclusive, sat_size, image_size);
+#endif
+}
+
+// The radius of a higher order kernel, limited so that its sums can't wrap around. (see DOF_TENT_MAX_BLUR_RADIUS)
+int dof_kernel_radius(int kernel, int radius)
+{
+    return min(radius, kernel == DOF_KERNEL_TENT ? DOF_TENT_MAX_BLUR_RADIUS : DOF_QUADRATIC_MAX_BLUR_RADIUS);
+}
+
+// The taps of a higher order kernel along one axis, as offsets from the pixel and their weights. Returns the number of taps.
+// Applied to the iterated SAT of order k, the difference g(x + w) - g(x) sums the SAT of order k - 1 over a box of width w.
+// Taking k of them convolves k boxes together, whose support is centered on the pixel:
+// - the tent is 2 boxes of width radius + 1.
+// - the quadratic is 2 boxes of width a and one of width b, with 2a + b = 2 * radius + 3 and a <= b <= a + 2.
+//   b is odd, so the kernel is symmetric around the pixel for any radius, and it's a B-spline when a == b.
+int dof_kernel_taps(int kernel, int radius, out int offsets[6], out int weights[6])
+{
+    if (kernel == DOF_KERNEL_TENT) {
+        int w = radius + 1;
+        offsets[0] = -radius;         weights[0] = 1;
+        offsets[1] = -radius + w;     weights[1] = -2;
+        offsets[2] = -radius + 2 * w; weights[2] = 1;
+        return 3;
+    }
+
+    int a = (2 * radius + 3) / 3;
+    int b = 2 * radius + 3 - 2 * a;
+    offsets[0] = -radius;             weights[0] = -1;
+    offsets[1] = -radius + a;         weights[1] = 2;
+    offsets[2] = -radius + 2 * a;     weights[2] = -1;
+    offsets[3] = -radius + b;         weights[3] = 1;
+    offsets[4] = -radius + a + b;     weights[4] = -2;
+    offsets[5] = -radius + 2 * a + b; weights[5] = 1;
+    return 6;
+}
+
+// The sum of the weights of a higher order kernel along one axis.
+int dof_kernel_weight(int kernel, int radius)
+{
+    if (kernel == DOF_KERNEL_TENT) {
+        return (radius + 1) * (radius + 1);
+    }
+
+    int a = (2 * radius + 3) / 3;
+    int b = 2 * radius + 3 - 2 * a;
+    return a * a * b;
+}
+
+// The weight of a higher order kernel along one axis that falls before the first pixel, for the pixel p.
+// The image is 0 there, so it's left out of the average. The kernel is symmetric, so this also gives the weight past the last pixel.
+// It's the kernel's taps applied to the iterated SAT of a row of ones starting at the first pixel, which is binomial(x, order).
+int dof_kernel_weight_before(int kernel, int radius, int p)
+{
+    if (p >= radius) {
+        return 0;
+    }
+
+    int offsets[6];
+    int weights[6];
+    int tap_count = dof_kernel_taps(kernel, radius, offsets, weights);
+
+    int inside = 0;
+    for (int i = 0; i < tap_count; i++)
+    {
+        int x = max(p + offsets[i], 0);
+        int binomial = kernel == DOF_KERNEL_TENT ? x * (x - 1) / 2 : x * (x - 1) * (x - 2) / 6;
+        inside += weights[i] * binomial;
+    }
+    return dof_kernel_weight(kernel, radius) - inside;
+}
+
+// Blurs pixel p with a higher order kernel of the given radius (in pixels), from the iterated SAT of the kernel's order.
+// The iterated SAT is exclusive like the GPU SAT, and padded past the image. (see SAT_ITERATED_PADDING)
+vec4 dof_kernel_filter(usampler2D sat, int kernel, ivec2 p, int radius, ivec2 image_size)
+{
+    radius = dof_kernel_radius(kernel, radius);
+
+    int offsets[6];
+    int weights[6];
+    int tap_count = dof_kernel_taps(kernel, radius, offsets, weights);
+
+    // the weights of the taps are the products of their weights along each axis.
+    // negative weights wrap around like the sums, so the total is still exact.
+    uvec4 sum = uvec4(0);
+    for (int j = 0; j < tap_count; j++)
+    {
+        for (int i = 0; i < tap_count; i++)
+        {
+            // nothing is summed before the image
+            ivec2 tap = p + ivec2(offsets[i], offsets[j]);
+            if (all(greaterThanEqual(tap, ivec2(0)))) {
+                sum += uint(weights[i] * weights[j]) * texelFetch(sat, tap, 0);
+            }
+        }
+    }
+
+    // the weight of the kernel that's inside the image
+    int weight = dof_kernel_weight(kernel, radius);
+    int weight_x = weight - dof_kernel_weight_before(kernel, radius, p.x) - dof_kernel_weight_before(kernel, radius, image_size.x - 1 - p.x);
+    int weight_y = weight - dof_kernel_weight_before(kernel, radius, p.y) - dof_kernel_weight_before(kernel, radius, image_size.y - 1 - p.y);
+
+    return vec4(sum) / (float(weight_x) * float(weight_y)) / 255.0;
+}
+
+// Encodes a linear color to sRGB, like writing to an sRGB framebuffer. Alpha is not encoded.
+// For the passes that write the backbuffer through an image, since sRGB formats can't be images.
+vec4 dof_encode_srgb(vec4 linear)
+{
+    vec3 c = clamp(linear.rgb, vec3(0.0), vec3(1.0));
+    vec3 encoded = mix(1.055 * pow(c, vec3(1.0 / 2.4)) - 0.055, c * 12.92, lessThanEqual(c, vec3(0.0031308)));
+    return vec4(encoded, clamp(linear.a, 0.0, 1.0));
+}
+#endif // __cplusplus
 
 #endif // PREAMBLE_GLSL
\ No newline at end of file
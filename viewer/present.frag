@@ -0,0 +1,12 @@
+layout(binding = PRESENT_COLOR_TEXTURE_BINDING) uniform sampler2D Color;
+
+layout(location = BLIT_TEXCOORD_VARYING_LOCATION) in vec2 TexCoord;
+
+out vec4 FragColor;
+
+// Clamps the linear HDR backbuffer to the window's range, and encodes it to sRGB like the LDR backbuffer is.
+// The texcoords scale it to the window, like the blit does.
+void main()
+{
+    FragColor = dof_encode_srgb(texture(Color, TexCoord));
+}
\ No newline at end of file
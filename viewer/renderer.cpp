@@ -1,26 +1,147 @@
 #include "renderer.h"
 
 #include "scene.h"
+#include "cpu_sat.h"
+#include "gpu_sat.h"
+#include "gpu_sat_tuning.h"
+#include "dof_tiles.h"
 
 #include "preamble.glsl"
 
 #include "imgui.h"
 
+#include <glm/gtc/color_space.hpp>
 #include <glm/gtx/transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <memory>
 
 #define NOMINMAX
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 
+// Ways to apply the DoF to the backbuffer.
+enum DoFPass
+{
+    // A fullscreen triangle (blit.vert, dof.frag).
+    DoFPass_Fullscreen,
+    // A quad per uniform or mixed tile, leaving the in-focus tiles as they are. (see DoFTiles)
+    DoFPass_Tiles,
+    // The tiles, except that the uniform tiles with small enough radii are blurred straight from the image by a workgroup each,
+    // with prefix sums along their rows then columns (dof_separable.comp). The other tiles are drawn from the SAT.
+    // Experimental: it's only been measured on llvmpipe, where it's several times slower than the plain tiles.
+    DoFPass_Separable,
+    // A workgroup per tile, with the SAT taps of the tile cached in shared memory, writing the backbuffer as an image (dof.comp).
+    DoFPass_Compute,
+    // Blurs each 2x2 block from the half and quarter resolution SATs, then upsamples the blur of the pixels out of focus,
+    // weighted by depth (dof_half.frag, dof_upsample.frag). The full resolution SAT isn't built. Needs the GPU SAT.
+    DoFPass_HalfResolution,
+    DoFPass_Count
+};
+
+static const char* GetDoFPassName(DoFPass pass)
+{
+    switch (pass)
+    {
+    case DoFPass_Fullscreen: return "Fullscreen";
+    case DoFPass_Tiles: return "Tiles";
+    case DoFPass_Separable: return "Separable Tiles (Experimental)";
+    case DoFPass_Compute: return "Compute";
+    case DoFPass_HalfResolution: return "Half Resolution";
+    default: return "Unknown";
+    }
+}
+
+static const char* GetDoFKernelName(int kernel)
+{
+    switch (kernel)
+    {
+    case DOF_KERNEL_BOX: return "Box";
+    case DOF_KERNEL_TENT: return "Tent";
+    case DOF_KERNEL_QUADRATIC: return "Quadratic";
+    default: return "Unknown";
+    }
+}
+
+// The stages of Renderer::Paint(), in order. Each stage uses what the ones before it produced, so redoing a stage redoes the ones after it.
+// The stages that are still valid are skipped, since what they produced is still in the backbuffers and the SAT.
+enum PaintStage
+{
+    // Renders the scene into the multisampled backbuffer.
+    PaintStage_Scene,
+    // Builds the SAT of the resolved backbuffer.
+    PaintStage_SAT,
+    // Resolves the backbuffer again, and blurs it with the SAT. The DoF is drawn in place, so the resolve undoes the last one.
+    PaintStage_DoF,
+    // Blits the backbuffer to the window and draws the GUI over it. Done every frame.
+    PaintStage_GUI,
+    PaintStage_Count
+};
+
+static const char* GetPaintStageName(PaintStage stage)
+{
+    switch (stage)
+    {
+    case PaintStage_Scene: return "Scene";
+    case PaintStage_SAT: return "SAT";
+    case PaintStage_DoF: return "DoF";
+    case PaintStage_GUI: return "GUI";
+    default: return "Unknown";
+    }
+}
+
+template<class T>
+static bool BytewiseEqual(const T& a, const T& b)
+{
+    return memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+static bool MaterialsEqual(const Material& a, const Material& b)
+{
+    // the name doesn't change how it's drawn
+    return BytewiseEqual(a.Ambient, b.Ambient) &&
+        BytewiseEqual(a.Diffuse, b.Diffuse) &&
+        BytewiseEqual(a.Specular, b.Specular) &&
+        a.Shininess == b.Shininess &&
+        a.DiffuseMapID == b.DiffuseMapID;
+}
+
+// Copies the objects of the list into the snapshot, and returns whether they changed since the last copy.
+template<class T, class EqualFn>
+static bool UpdateSnapshot(const packed_freelist<T>& list, std::vector<T>* snapshot, EqualFn equal)
+{
+    bool changed = snapshot->size() != list.size();
+    snapshot->resize(list.size());
+
+    size_t i = 0;
+    for (uint32_t id : list)
+    {
+        const T& object = list[id];
+        if (!changed && !equal((*snapshot)[i], object))
+        {
+            changed = true;
+        }
+        (*snapshot)[i] = object;
+        i++;
+    }
+
+    return changed;
+}
+
 class Renderer : public IRenderer
 {
 public:
     const int kSampleCount = 4;
     const int kMaxTextureCount = 32;
+    // Number of pixel pack buffers used to read back the backbuffer for the CPU SAT.
+    // Allows the readback to be consumed up to kReadbackRingSize - 1 frames after it was issued.
+    static const int kReadbackRingSize = 4;
+    // Number of persistently mapped buffers the CPU SAT is written to before being uploaded.
+    // Triple buffering lets the CPU write the next SAT while the GPU is still copying the previous ones.
+    static const int kSATUploadRingSize = 3;
 
     struct GPUTimestamps
     {
@@ -32,8 +153,15 @@ public:
             MultisampleResolveEnd,
             ReadbackBackbufferStart,
             ReadbackBackbufferEnd,
-            ComputeSATStart,
-            ComputeSATEnd,
+            // one pair per SATAlgorithm, in the same order, so they can be compared
+            ComputeSATUpDownSweepStart,
+            ComputeSATUpDownSweepEnd,
+            ComputeSATLookBackStart,
+            ComputeSATLookBackEnd,
+            ComputeSATSubgroupStart,
+            ComputeSATSubgroupEnd,
+            ComputeSATUpDownSweepPaddedStart,
+            ComputeSATUpDownSweepPaddedEnd,
             SATUploadStart,
             SATUploadEnd,
             DOFBlurStart,
@@ -49,7 +177,10 @@ public:
             "RenderScene",
             "MultisampleResolve",
             "ReadbackBackbuffer",
-            "ComputeSAT",
+            "ComputeSAT (Up/Down-Sweep)",
+            "ComputeSAT (Look-Back)",
+            "ComputeSAT (Subgroups)",
+            "ComputeSAT (Up/Down-Sweep Padded)",
             "SATUpload",
             "DOfBlur",
             "RenderGUI",
@@ -94,6 +225,12 @@ public:
     GLuint mBackbufferFBOSS;
     GLuint mBackbufferColorTOSS;
     GLuint mBackbufferDepthTOSS;
+    // An RGBA8 view of mBackbufferColorTOSS, for writing it as an image. Not allocated for the HDR backbuffer.
+    GLuint mBackbufferColorViewTOSS;
+    // Whether the backbuffers are linear RGBA16F rather than sRGB. They are with the HDR SAT.
+    bool mBackbufferHDR;
+    // Draws the HDR backbuffer to the window.
+    GLuint* mPresentSP;
 
     // empty VAO, for attrib-less rendering passes
     GLuint mNullVAO;
@@ -102,22 +239,75 @@ public:
     int mWindowWidth;
     int mWindowHeight;
 
-    int mSummedAreaTableWidth;
-    int mSummedAreaTableHeight;
+    GPUSAT mGPUSAT;
+    // The half and quarter resolution levels of the SAT pyramid (mCoarseGPUSATs[i] is level i + 1).
+    GPUSAT mCoarseGPUSATs[DOF_SAT_LEVEL_COUNT - 1];
+    int mSATPyramid;
+    int mSATFormat;
+    int mSATAlgorithm;
+    int mSATColumnPass;
     bool mUseCPUForSAT;
+    bool mUseCPUSATReference;
+    int mCPUSATKernelISA;
+    // Ring of PBOs the backbuffer is asynchronously read into, each with a fence signaled when the read completes.
+    GLuint mReadbackPBOs[kReadbackRingSize];
+    GLsync mReadbackFences[kReadbackRingSize];
+    int mNextReadbackIndex;
+    // How many frames old the readback consumed by the CPU SAT is. 0 means a synchronous readback.
+    int mReadbackLatency;
+    // Points into the mapped readback PBO while the CPU SAT is computed.
     glm::u8vec4* mCPUBackbufferReadback;
+    // Computes the CPU SAT on a separate thread when pipelined.
+    // The SAT of one frame is then uploaded and used by the DoF of the next frame.
+    bool mPipelineCPUSAT;
+    std::unique_ptr<CPUSATWorker> mCPUSATWorker;
+    bool mCPUSATJobInFlight;
+    int mCPUSATJobReadbackIndex;
+    int mCPUSATJobUploadIndex;
+    // Persistently mapped unpack buffers the CPU SAT is written into, each with a fence signaled when its upload completes.
+    GLuint mSATUploadPBOs[kSATUploadRingSize];
+    GLsync mSATUploadFences[kSATUploadRingSize];
+    glm::uvec4* mSATUploadPointers[kSATUploadRingSize];
+    int mNextSATUploadIndex;
+    // Points into the mapped upload buffer the CPU SAT is currently written to.
     glm::uvec4* mCPUSummedAreaTable;
-    GLuint* mSummedAreaTableUpsweepSP;
-    GLuint* mSummedAreaTableDownsweepSP;
-    GLuint* mTransposeSummedAreaTableSP;
-    GLuint mSummedRowsTO, *mSummedAreaTableTO; // aliases
-    GLuint mSummedRowsWGSumsTO;
-    GLuint mSummedColsTO;
-    GLuint mSummedColsWGSumsTO;
 
     bool mEnableDoF;
-    GLuint* mDepthOfFieldSP;
+    GLuint* mDepthOfFieldSP[SATFormat_Count];
     float mFocusDepth;
+    int mDoFPass;
+    // DOF_KERNEL_*. The higher order kernels blur from an iterated SAT, built in place of the SAT pyramid.
+    int mDoFKernel;
+    DoFTiles mDoFTiles;
+    GLuint* mDepthOfFieldUniformTilesSP[SATFormat_Count];
+    GLuint* mDepthOfFieldMixedTilesSP[SATFormat_Count];
+    GLuint* mDepthOfFieldComputeSP[SATFormat_Count];
+    GLuint* mDepthOfFieldHalfSP[SATFormat_Count];
+    GLuint* mDepthOfFieldUpsampleSP;
+    GLuint* mDepthOfFieldSeparableSP;
+    GLuint* mDepthOfFieldSeparableCopySP;
+    // The blur of each 2x2 block (linear color, and the depth it was blurred for). Only allocated for the half resolution DoF.
+    GLuint mHalfDoFFBO;
+    GLuint mHalfDoFColorTO;
+    GLuint mHalfDoFDepthTO;
+    // The separable tiles, blurred from the backbuffer then copied over it. Only allocated for the separable DoF.
+    GLuint mSeparableDoFOutputTO;
+
+    // The first stage the next Paint() has to redo. (see InvalidateChangedStages)
+    PaintStage mFirstInvalidStage;
+    // The first stage the last Paint() redid.
+    PaintStage mLastRedoneStage;
+    // Skips the stages whose inputs didn't change since the last frame. Off to profile every stage every frame.
+    bool mSkipValidStages;
+    // What the last frame was painted with.
+    Camera mLastCamera;
+    std::vector<Transform> mLastTransforms;
+    std::vector<Instance> mLastInstances;
+    std::vector<Material> mLastMaterials;
+    std::vector<int> mLastSATSettings;
+    std::vector<float> mLastDoFSettings;
+    // The number of frames the SAT still lags behind the last change to the backbuffer. (see GetSATLatency)
+    int mStaleSATFrameCount;
 
     GLuint mGPUTimestampQueries[GPUTimestamps::Count];
     GLuint64 mGPUTimestampQueryResults[GPUTimestamps::Count];
@@ -133,17 +323,42 @@ public:
         mShaders.SetPreambleFile("preamble.glsl");
 
         mSceneSP = mShaders.AddProgramFromExts({ "scene.vert", "scene.frag" });
-        mSummedAreaTableUpsweepSP = mShaders.AddProgramFromExts({ "sat_up.comp" });
-        mSummedAreaTableDownsweepSP = mShaders.AddProgramFromExts({ "sat_down.comp" });
-        mTransposeSummedAreaTableSP = mShaders.AddProgramFromExts({ "sat_transpose.comp" });
-        mDepthOfFieldSP = mShaders.AddProgramFromExts({ "blit.vert", "dof.frag" });
+        mPresentSP = mShaders.AddProgramFromExts({ "blit.vert", "present.frag" });
+        SATWorkgroupSizes satWorkgroupSizes = LoadOrTuneSATWorkgroupSizes("sat_tuning.txt", "440", "preamble.glsl");
+        mGPUSAT.Init(&mShaders, satWorkgroupSizes);
+        for (GPUSAT& coarseGPUSAT : mCoarseGPUSATs)
+        {
+            coarseGPUSAT.Init(&mShaders, satWorkgroupSizes);
+        }
+        for (int format = 0; format < SATFormat_Count; format++)
+        {
+            mDepthOfFieldSP[format] = mShaders.AddProgramFromExts({ "blit.vert", "dof.frag" }, GetSATFormatDefines((SATFormat)format));
+            mDepthOfFieldUniformTilesSP[format] = mShaders.AddProgramFromExts({ "dof_tile.vert", "dof.frag" }, GetSATFormatDefines((SATFormat)format) + "#define DOF_UNIFORM_TILES\n");
+            mDepthOfFieldMixedTilesSP[format] = mShaders.AddProgramFromExts({ "dof_tile.vert", "dof.frag" }, GetSATFormatDefines((SATFormat)format));
+            // the HDR SAT doesn't use the compute or half resolution passes (see GetDoFPass)
+            if (format != SATFormat_HDR)
+            {
+                mDepthOfFieldComputeSP[format] = mShaders.AddProgramFromExts({ "dof.comp" }, GetSATFormatDefines((SATFormat)format));
+                mDepthOfFieldHalfSP[format] = mShaders.AddProgramFromExts({ "blit.vert", "dof_half.frag" }, GetSATFormatDefines((SATFormat)format));
+            }
+        }
+        mDepthOfFieldUpsampleSP = mShaders.AddProgramFromExts({ "blit.vert", "dof_upsample.frag" });
+        mDepthOfFieldSeparableSP = mShaders.AddProgramFromExts({ "dof_separable.comp" });
+        mDepthOfFieldSeparableCopySP = mShaders.AddProgramFromExts({ "dof_tile.vert", "dof_separable_copy.frag" });
+        mDoFTiles.Init(&mShaders);
 
         glGenVertexArrays(1, &mNullVAO);
         glBindVertexArray(mNullVAO);
         glBindVertexArray(0);
 
         mEnableDoF = true;
+        mSkipValidStages = true;
+        mFirstInvalidStage = PaintStage_Scene;
         mFocusDepth = 5.0f;
+        mDoFPass = DoFPass_Tiles;
+
+        mCPUSATKernelISA = GetBestCPUSATKernelISA();
+        mReadbackLatency = 1;
 
         glGenQueries(GPUTimestamps::Count, &mGPUTimestampQueries[0]);
     }
@@ -156,16 +371,23 @@ public:
         mBackbufferWidth = mWindowWidth;
         mBackbufferHeight = mWindowHeight;
 
+        // everything is reallocated
+        InvalidateStage(PaintStage_Scene);
+
         // OS X doesn't like it when you delete framebuffers it's using
         // No big deal, this happens implicitly anyways.
         glFinish();
 
+        // the HDR SAT is built from a linear HDR backbuffer
+        mBackbufferHDR = mSATFormat == SATFormat_HDR;
+        GLenum backbufferColorFormat = mBackbufferHDR ? GL_RGBA16F : GL_SRGB8_ALPHA8;
+
         // Init multisampled FBO
         {
             glDeleteTextures(1, &mBackbufferColorTOMS);
             glGenTextures(1, &mBackbufferColorTOMS);
             glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, mBackbufferColorTOMS);
-            glTexStorage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, kSampleCount, GL_SRGB8_ALPHA8, mBackbufferWidth, mBackbufferHeight, GL_TRUE);
+            glTexStorage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, kSampleCount, backbufferColorFormat, mBackbufferWidth, mBackbufferHeight, GL_TRUE);
             glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
 
             glDeleteTextures(1, &mBackbufferDepthTOMS);
@@ -191,9 +413,18 @@ public:
             glDeleteTextures(1, &mBackbufferColorTOSS);
             glGenTextures(1, &mBackbufferColorTOSS);
             glBindTexture(GL_TEXTURE_2D, mBackbufferColorTOSS);
-            glTexStorage2D(GL_TEXTURE_2D, 1, GL_SRGB8_ALPHA8, mBackbufferWidth, mBackbufferHeight);
+            glTexStorage2D(GL_TEXTURE_2D, 1, backbufferColorFormat, mBackbufferWidth, mBackbufferHeight);
             glBindTexture(GL_TEXTURE_2D, 0);
 
+            // sRGB formats can't be images, so the compute DoF encodes the color itself
+            glDeleteTextures(1, &mBackbufferColorViewTOSS);
+            mBackbufferColorViewTOSS = 0;
+            if (!mBackbufferHDR)
+            {
+                glGenTextures(1, &mBackbufferColorViewTOSS);
+                glTextureView(mBackbufferColorViewTOSS, GL_TEXTURE_2D, mBackbufferColorTOSS, GL_RGBA8, 0, 1, 0, 1);
+            }
+
             glDeleteTextures(1, &mBackbufferDepthTOSS);
             glGenTextures(1, &mBackbufferDepthTOSS);
             glBindTexture(GL_TEXTURE_2D, mBackbufferDepthTOSS);
@@ -214,67 +445,344 @@ public:
 
         // Init summed area table
         {
-            mSummedAreaTableWidth = (mBackbufferWidth + SAT_WORKGROUP_SIZE_X - 1) & -SAT_WORKGROUP_SIZE_X;
-            mSummedAreaTableHeight = (mBackbufferHeight + SAT_WORKGROUP_SIZE_X - 1) & -SAT_WORKGROUP_SIZE_X;
+            // the buffers used by the worker thread are about to be deleted
+            if (mCPUSATJobInFlight)
+            {
+                FinishCPUSATJob();
+            }
 
-            // The workgroup sums need to be computed in a single workgroup
-            // could generalize this to an arbitrary number of iterations, but meh.
-            assert(mSummedAreaTableWidth / SAT_WORKGROUP_SIZE_X <= SAT_WORKGROUP_SIZE_X);
-            assert(mSummedAreaTableHeight / SAT_WORKGROUP_SIZE_X <= SAT_WORKGROUP_SIZE_X);
+            ResizeSAT();
 
-            delete[] mCPUBackbufferReadback;
-            mCPUBackbufferReadback = new glm::u8vec4[mBackbufferWidth * mBackbufferHeight];
+            mDoFTiles.Resize(mBackbufferWidth, mBackbufferHeight);
 
-            delete[] mCPUSummedAreaTable;
-            mCPUSummedAreaTable = new glm::uvec4[mSummedAreaTableWidth * mSummedAreaTableHeight];
+            for (int i = 0; i < kReadbackRingSize; i++)
+            {
+                glDeleteSync(mReadbackFences[i]);
+                mReadbackFences[i] = 0;
+            }
+            mNextReadbackIndex = 0;
 
-            glDeleteTextures(1, &mSummedRowsTO);
-            glGenTextures(1, &mSummedRowsTO);
-            glBindTexture(GL_TEXTURE_2D, mSummedRowsTO);
-            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA32UI, mSummedAreaTableWidth, mSummedAreaTableHeight);
-            glBindTexture(GL_TEXTURE_2D, 0);
+            glDeleteBuffers(kReadbackRingSize, &mReadbackPBOs[0]);
+            glGenBuffers(kReadbackRingSize, &mReadbackPBOs[0]);
+            for (int i = 0; i < kReadbackRingSize; i++)
+            {
+                glBindBuffer(GL_PIXEL_PACK_BUFFER, mReadbackPBOs[i]);
+                glBufferData(GL_PIXEL_PACK_BUFFER, mBackbufferWidth * mBackbufferHeight * sizeof(glm::u8vec4), NULL, GL_STREAM_READ);
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+            for (int i = 0; i < kSATUploadRingSize; i++)
+            {
+                glDeleteSync(mSATUploadFences[i]);
+                mSATUploadFences[i] = 0;
+            }
+            mNextSATUploadIndex = 0;
+
+            // deleting the buffers also unmaps them
+            glDeleteBuffers(kSATUploadRingSize, &mSATUploadPBOs[0]);
+            glGenBuffers(kSATUploadRingSize, &mSATUploadPBOs[0]);
+            for (int i = 0; i < kSATUploadRingSize; i++)
+            {
+                GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                GLsizeiptr size = mBackbufferWidth * mBackbufferHeight * sizeof(glm::uvec4);
+
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mSATUploadPBOs[i]);
+                glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, NULL, flags);
+                mSATUploadPointers[i] = (glm::uvec4*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags);
+            }
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+    }
+
+    // Makes the next Paint() redo the stage, and the ones after it.
+    void InvalidateStage(PaintStage stage)
+    {
+        mFirstInvalidStage = std::min(mFirstInvalidStage, stage);
+    }
+
+    // The number of frames the SAT used by the DoF lags behind the backbuffer.
+    // The CPU SAT is computed from a readback that's mReadbackLatency frames old, and uploaded a frame later when pipelined.
+    int GetSATLatency() const
+    {
+        if (!UseCPUForSAT())
+        {
+            return 0;
+        }
+
+        return mReadbackLatency + (mPipelineCPUSAT ? 1 : 0);
+    }
+
+    // Compares the scene and the settings with the ones the last frame was painted with,
+    // and invalidates the stages that depend on what changed.
+    void InvalidateChangedStages()
+    {
+        if (!mSkipValidStages)
+        {
+            InvalidateStage(PaintStage_Scene);
+        }
+
+        // every snapshot is updated, even once a change was found
+        bool sceneChanged = false;
+        Camera& mainCamera = mScene->Cameras[mScene->MainCameraID];
+        if (!BytewiseEqual(mainCamera, mLastCamera))
+        {
+            sceneChanged = true;
+            mLastCamera = mainCamera;
+        }
+        sceneChanged |= UpdateSnapshot(mScene->Transforms, &mLastTransforms, BytewiseEqual<Transform>);
+        sceneChanged |= UpdateSnapshot(mScene->Instances, &mLastInstances, BytewiseEqual<Instance>);
+        sceneChanged |= UpdateSnapshot(mScene->Materials, &mLastMaterials, MaterialsEqual);
+        if (sceneChanged)
+        {
+            InvalidateStage(PaintStage_Scene);
+        }
+
+        // the SAT isn't built while the DoF is disabled, so enabling it rebuilds it.
+        // everything that makes Paint() reallocate the SAT (see ResizeSAT) is here too, so the new textures are filled in.
+        std::vector<int> satSettings = {
+            mEnableDoF, mSATFormat, mSATAlgorithm, mSATColumnPass, GetDoFSATLevels(), DOF_KERNEL_ORDER(GetDoFKernel()),
+            IsHalfResolutionDoF(), GetDoFPass() == DoFPass_Separable,
+            UseCPUForSAT(), mUseCPUSATReference, mCPUSATKernelISA, mReadbackLatency, mPipelineCPUSAT
+        };
+        if (satSettings != mLastSATSettings)
+        {
+            InvalidateStage(PaintStage_SAT);
+            mLastSATSettings = satSettings;
+        }
+
+        std::vector<float> dofSettings = { (float)mEnableDoF, (float)mDoFPass, (float)mDoFKernel, mFocusDepth };
+        if (dofSettings != mLastDoFSettings)
+        {
+            InvalidateStage(PaintStage_DoF);
+            mLastDoFSettings = dofSettings;
+        }
+
+        // a lagging SAT keeps being rebuilt until it has caught up with the last change
+        if (mFirstInvalidStage <= PaintStage_SAT)
+        {
+            mStaleSATFrameCount = GetSATLatency();
+        }
+        else if (mStaleSATFrameCount > 0)
+        {
+            InvalidateStage(PaintStage_SAT);
+            mStaleSATFrameCount--;
+        }
+    }
+
+    // Whether the SAT is computed on the CPU. The CPU SAT is only built from an 8-bit readback, so the HDR SAT is always built on the GPU.
+    bool UseCPUForSAT() const
+    {
+        return mUseCPUForSAT && mSATFormat != SATFormat_HDR;
+    }
+
+    // The DoF pass that's used. The compute, half resolution and separable passes write 8-bit color,
+    // so the HDR SAT falls back to the fullscreen pass, or to the plain tiles.
+    int GetDoFPass() const
+    {
+        if (mSATFormat == SATFormat_HDR)
+        {
+            if (mDoFPass == DoFPass_Separable)
+            {
+                return DoFPass_Tiles;
+            }
+            if (mDoFPass == DoFPass_Compute || mDoFPass == DoFPass_HalfResolution)
+            {
+                return DoFPass_Fullscreen;
+            }
+        }
+        return mDoFPass;
+    }
+
+    // Whether the DoF is blurred at half resolution. The CPU SAT is only built at full resolution, so it can't be.
+    bool IsHalfResolutionDoF() const
+    {
+        return GetDoFPass() == DoFPass_HalfResolution && !UseCPUForSAT();
+    }
+
+    // The kernel the DoF is blurred with. The higher order kernels are only blurred by dof.frag, from an RGBA32UI GPU SAT.
+    int GetDoFKernel() const
+    {
+        int dofPass = GetDoFPass();
+        if (UseCPUForSAT() || mSATFormat != SATFormat_RGBA32UI || (dofPass != DoFPass_Fullscreen && dofPass != DoFPass_Tiles))
+        {
+            return DOF_KERNEL_BOX;
+        }
+        return mDoFKernel;
+    }
+
+    // The mask of the SAT levels that are built for the DoF. (see DOF_SAT_LEVELS_UNIFORM_LOCATION)
+    int GetDoFSATLevels() const
+    {
+        // a higher order kernel only blurs from the full resolution SAT, and the HDR SAT is only built at full resolution
+        if (UseCPUForSAT() || mSATFormat == SATFormat_HDR || GetDoFKernel() != DOF_KERNEL_BOX)
+        {
+            return 1;
+        }
+
+        int levels = GetSATPyramidLevels((SATPyramid)mSATPyramid);
+        if (IsHalfResolutionDoF())
+        {
+            levels &= ~1;
+            if (levels == 0)
+            {
+                levels = 1 << 1;
+            }
+        }
+        return levels;
+    }
 
-            mSummedAreaTableTO = &mSummedRowsTO;
+    // The largest radius of the separable tiles: the radii that dof.frag blurs from the full resolution SAT,
+    // so the tiles match the tiles drawn around them. 0 if the full resolution SAT isn't built. (see dof_sat_level)
+    int GetSeparableDoFMaxRadius() const
+    {
+        int satLevels = GetDoFSATLevels();
+        if ((satLevels & 1) == 0)
+        {
+            return 0;
+        }
 
-            glDeleteTextures(1, &mSummedRowsWGSumsTO);
-            glGenTextures(1, &mSummedRowsWGSumsTO);
-            glBindTexture(GL_TEXTURE_2D, mSummedRowsWGSumsTO);
-            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA32UI, mSummedAreaTableWidth / SAT_WORKGROUP_SIZE_X, mSummedAreaTableHeight);
+        for (int level = 1; level < DOF_SAT_LEVEL_COUNT; level++)
+        {
+            if (satLevels & (1 << level))
+            {
+                return std::min(DOF_SEPARABLE_MAX_BLUR_RADIUS, (DOF_SAT_LEVEL_MIN_RADIUS << level) - 1);
+            }
+        }
+        return DOF_SEPARABLE_MAX_BLUR_RADIUS;
+    }
+
+    // (Re)allocates the SAT pyramid in the selected format and kernel order, and the half resolution or separable DoF buffers if they're used.
+    void ResizeSAT()
+    {
+        // the half resolution DoF has no use for the full resolution SAT, so it's shrunk to a texel.
+        bool halfResDoF = IsHalfResolutionDoF();
+        if (halfResDoF)
+        {
+            mGPUSAT.Resize(1, 1, (SATFormat)mSATFormat);
+        }
+        else
+        {
+            mGPUSAT.Resize(mBackbufferWidth, mBackbufferHeight, (SATFormat)mSATFormat, 0, DOF_KERNEL_ORDER(GetDoFKernel()));
+        }
+        for (int level = 1; level < DOF_SAT_LEVEL_COUNT; level++)
+        {
+            mCoarseGPUSATs[level - 1].Resize(mBackbufferWidth, mBackbufferHeight, (SATFormat)mSATFormat, level);
+        }
+
+        glDeleteTextures(1, &mHalfDoFColorTO);
+        mHalfDoFColorTO = 0;
+        glDeleteTextures(1, &mHalfDoFDepthTO);
+        mHalfDoFDepthTO = 0;
+        glDeleteFramebuffers(1, &mHalfDoFFBO);
+        mHalfDoFFBO = 0;
+        glDeleteTextures(1, &mSeparableDoFOutputTO);
+        mSeparableDoFOutputTO = 0;
+
+        if (halfResDoF)
+        {
+            // the size of the half resolution SAT
+            int halfWidth = (mBackbufferWidth + 1) / 2;
+            int halfHeight = (mBackbufferHeight + 1) / 2;
+
+            glGenTextures(1, &mHalfDoFColorTO);
+            glBindTexture(GL_TEXTURE_2D, mHalfDoFColorTO);
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA16F, halfWidth, halfHeight);
             glBindTexture(GL_TEXTURE_2D, 0);
 
-            glDeleteTextures(1, &mSummedColsTO);
-            glGenTextures(1, &mSummedColsTO);
-            glBindTexture(GL_TEXTURE_2D, mSummedColsTO);
-            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA32UI, mSummedAreaTableHeight, mSummedAreaTableWidth);
+            glGenTextures(1, &mHalfDoFDepthTO);
+            glBindTexture(GL_TEXTURE_2D, mHalfDoFDepthTO);
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32F, halfWidth, halfHeight);
             glBindTexture(GL_TEXTURE_2D, 0);
 
-            glDeleteTextures(1, &mSummedColsWGSumsTO);
-            glGenTextures(1, &mSummedColsWGSumsTO);
-            glBindTexture(GL_TEXTURE_2D, mSummedColsWGSumsTO);
-            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA32UI, mSummedAreaTableHeight / SAT_WORKGROUP_SIZE_X, mSummedAreaTableWidth);
+            glGenFramebuffers(1, &mHalfDoFFBO);
+            glBindFramebuffer(GL_FRAMEBUFFER, mHalfDoFFBO);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + DOF_HALF_COLOR_OUTPUT_LOCATION, GL_TEXTURE_2D, mHalfDoFColorTO, 0);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + DOF_HALF_DEPTH_OUTPUT_LOCATION, GL_TEXTURE_2D, mHalfDoFDepthTO, 0);
+            GLenum drawBuffers[] = { GL_COLOR_ATTACHMENT0 + DOF_HALF_COLOR_OUTPUT_LOCATION, GL_COLOR_ATTACHMENT0 + DOF_HALF_DEPTH_OUTPUT_LOCATION };
+            glDrawBuffers(2, drawBuffers);
+            GLenum fboStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+            if (fboStatus != GL_FRAMEBUFFER_COMPLETE) {
+                fprintf(stderr, "glCheckFramebufferStatus: %x\n", fboStatus);
+            }
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        }
+
+        if (GetDoFPass() == DoFPass_Separable)
+        {
+            // not sRGB, so it can be an image. The tiles are encoded to sRGB by the shader.
+            glGenTextures(1, &mSeparableDoFOutputTO);
+            glBindTexture(GL_TEXTURE_2D, mSeparableDoFOutputTO);
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, mBackbufferWidth, mBackbufferHeight);
             glBindTexture(GL_TEXTURE_2D, 0);
         }
     }
 
+    // Returns the index of an upload buffer the CPU SAT can be written into.
+    // Waits for the GPU to be done uploading from the buffer the last time it was used.
+    // It was used kSATUploadRingSize uploads ago, so this should never actually wait.
+    int AcquireSATUploadBuffer()
+    {
+        int satUploadIndex = mNextSATUploadIndex;
+        mNextSATUploadIndex = (mNextSATUploadIndex + 1) % kSATUploadRingSize;
+
+        if (mSATUploadFences[satUploadIndex])
+        {
+            GLenum waitStatus;
+            do
+            {
+                waitStatus = glClientWaitSync(mSATUploadFences[satUploadIndex], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            } while (waitStatus == GL_TIMEOUT_EXPIRED);
+
+            glDeleteSync(mSATUploadFences[satUploadIndex]);
+            mSATUploadFences[satUploadIndex] = 0;
+        }
+
+        return satUploadIndex;
+    }
+
+    // Waits for the SAT being computed on the worker thread, and releases the readback it was computed from.
+    // The SAT is left in mSATUploadPointers[mCPUSATJobUploadIndex].
+    void FinishCPUSATJob()
+    {
+        mCPUSATWorker->Wait();
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, mReadbackPBOs[mCPUSATJobReadbackIndex]);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        mCPUSATJobInFlight = false;
+    }
+
     void UpdateGUI()
     {
         // Readback last frame's timestamps and display them
         if (ImGui::Begin("Renderer Profiling") && !mFirstFrame)
         {
-            ImGui::Text("GPU time");
+            // the stages that were skipped show the time of the last frame that did them
+            ImGui::Text("Redone from stage: %s", GetPaintStageName(mLastRedoneStage));
+            ImGui::Text("\nGPU time");
             for (int i = 0; i < GPUTimestamps::Count / 2; i++)
             {
-                if (!mUseCPUForSAT)
+                bool isComputeSAT = i * 2 >= GPUTimestamps::ComputeSATUpDownSweepStart &&
+                    i * 2 < GPUTimestamps::ComputeSATUpDownSweepStart + SATAlgorithm_Count * 2;
+
+                if (!UseCPUForSAT())
                 {
                     if (i * 2 == GPUTimestamps::ReadbackBackbufferStart ||
                         i * 2 == GPUTimestamps::SATUploadStart)
                     {
                         continue;
                     }
+
+                    // only the algorithm used last frame has timestamps
+                    if (isComputeSAT && i * 2 != GPUTimestamps::ComputeSATUpDownSweepStart + mSATAlgorithm * 2)
+                    {
+                        continue;
+                    }
                 }
                 else
                 {
-                    if (i * 2 == GPUTimestamps::ComputeSATStart)
+                    if (isComputeSAT)
                     {
                         continue;
                     }
@@ -286,6 +794,19 @@ public:
                 uint64_t ns = mGPUTimestampQueryResults[i * 2 + 1] - mGPUTimestampQueryResults[i * 2 + 0];
                 uint64_t ms = ns / 1000000;
                 ImGui::Text("%s: %d.%d milliseconds", GPUTimestamps::Names[i], ms, ns / 1000 - ms * 1000);
+
+                // the transposes are timed by the SAT itself, as part of ComputeSAT
+                if (isComputeSAT && mSATColumnPass != SATColumnPass_InPlace)
+                {
+                    uint64_t transposeNs;
+                    if (mGPUSAT.GetTransposeTime(&transposeNs))
+                    {
+                        uint64_t transposeMs = transposeNs / 1000000;
+                        ImGui::Text("  Transposes (%s): %d.%d milliseconds",
+                            GetSATColumnPassName((SATColumnPass)mSATColumnPass),
+                            transposeMs, transposeNs / 1000 - transposeMs * 1000);
+                    }
+                }
             }
 
             ImGui::Text("\nCPU time");
@@ -295,7 +816,7 @@ public:
 
             for (int i = 0; i < CPUTimestamps::Count / 2; i++)
             {
-                if (!mUseCPUForSAT)
+                if (!UseCPUForSAT())
                 {
                     if (i * 2 == CPUTimestamps::ReadbackBackbufferStart ||
                         i * 2 == CPUTimestamps::ComputeSATStart ||
@@ -316,7 +837,124 @@ public:
         if (ImGui::Begin("Renderer"))
         {
             ImGui::Checkbox("Enable DoF", &mEnableDoF);
+            ImGui::Checkbox("Skip Unchanged Stages", &mSkipValidStages);
+
+            const char* dofPassNames[DoFPass_Count];
+            for (int pass = 0; pass < DoFPass_Count; pass++)
+            {
+                dofPassNames[pass] = GetDoFPassName((DoFPass)pass);
+            }
+
+            ImGui::Combo("DoF Pass", &mDoFPass, dofPassNames, DoFPass_Count);
+            if (mDoFPass == DoFPass_HalfResolution && UseCPUForSAT())
+            {
+                ImGui::Text("The CPU SAT is only built at full resolution, using the fullscreen pass.");
+            }
+            if (mDoFPass == DoFPass_Separable)
+            {
+                ImGui::Text("Not known to be faster than the plain tiles, compare their DoF timings.");
+            }
+            if (GetDoFPass() != mDoFPass)
+            {
+                ImGui::Text("Writes 8-bit color, not supported by the HDR SAT. Using the %s pass.", GetDoFPassName((DoFPass)GetDoFPass()));
+            }
             ImGui::Checkbox("CPU SAT", &mUseCPUForSAT);
+            if (mUseCPUForSAT && !UseCPUForSAT())
+            {
+                ImGui::Text("Not supported by the HDR SAT, using the GPU SAT.");
+            }
+
+            const char* kernelNames[DOF_KERNEL_COUNT];
+            for (int kernel = 0; kernel < DOF_KERNEL_COUNT; kernel++)
+            {
+                kernelNames[kernel] = GetDoFKernelName(kernel);
+            }
+
+            ImGui::Combo("DoF Kernel", &mDoFKernel, kernelNames, DOF_KERNEL_COUNT);
+            if (GetDoFKernel() != mDoFKernel)
+            {
+                ImGui::Text("Only the fullscreen and tile passes blur with it, from an RGBA32UI GPU SAT. Using the box.");
+            }
+            else if (mDoFKernel == DOF_KERNEL_TENT)
+            {
+                ImGui::Text("Blur radius limited to %d pixels.", DOF_TENT_MAX_BLUR_RADIUS);
+            }
+            else if (mDoFKernel == DOF_KERNEL_QUADRATIC)
+            {
+                ImGui::Text("Blur radius limited to %d pixels.", DOF_QUADRATIC_MAX_BLUR_RADIUS);
+            }
+
+            const char* formatNames[SATFormat_Count];
+            for (int format = 0; format < SATFormat_Count; format++)
+            {
+                formatNames[format] = GetSATFormatName((SATFormat)format);
+            }
+
+            ImGui::Combo("SAT Format", &mSATFormat, formatNames, SATFormat_Count);
+            if (mSATFormat == SATFormat_Compact)
+            {
+                ImGui::Text("Blur radius limited to %d pixels.", SAT_COMPACT_MAX_BLUR_RADIUS);
+            }
+            else if (mSATFormat == SATFormat_HDR)
+            {
+                ImGui::Text("Built on the GPU at full resolution, from an RGBA16F backbuffer.");
+            }
+            if (!UseCPUForSAT())
+            {
+                const char* algorithmNames[SATAlgorithm_Count];
+                for (int algorithm = 0; algorithm < SATAlgorithm_Count; algorithm++)
+                {
+                    algorithmNames[algorithm] = GetSATAlgorithmName((SATAlgorithm)algorithm);
+                }
+
+                ImGui::Combo("SAT Algorithm", &mSATAlgorithm, algorithmNames, SATAlgorithm_Count);
+                if (!mGPUSAT.IsAlgorithmSupported((SATAlgorithm)mSATAlgorithm))
+                {
+                    ImGui::Text("Not supported by this GPU, using the up/down-sweep kernels.");
+                }
+
+                const char* columnPassNames[SATColumnPass_Count];
+                for (int columnPass = 0; columnPass < SATColumnPass_Count; columnPass++)
+                {
+                    columnPassNames[columnPass] = GetSATColumnPassName((SATColumnPass)columnPass);
+                }
+
+                ImGui::Combo("SAT Column Pass", &mSATColumnPass, columnPassNames, SATColumnPass_Count);
+
+                const char* pyramidNames[SATPyramid_Count];
+                for (int pyramid = 0; pyramid < SATPyramid_Count; pyramid++)
+                {
+                    pyramidNames[pyramid] = GetSATPyramidName((SATPyramid)pyramid);
+                }
+
+                ImGui::Combo("SAT Pyramid Levels", &mSATPyramid, pyramidNames, SATPyramid_Count);
+
+                SATWorkgroupSizes workgroupSizes = mGPUSAT.GetWorkgroupSizes();
+                ImGui::Text("SAT workgroup sizes: %d, %dx%d (see sat_tuning.txt)", workgroupSizes.Scan, workgroupSizes.Transpose, workgroupSizes.Transpose);
+            }
+            if (UseCPUForSAT())
+            {
+                ImGui::Checkbox("Reference CPU SAT", &mUseCPUSATReference);
+                if (!mUseCPUSATReference && mSATFormat != SATFormat_Compact)
+                {
+                    const char* isaNames[CPUSATKernelISA_Count];
+                    for (int isa = 0; isa < CPUSATKernelISA_Count; isa++)
+                    {
+                        isaNames[isa] = GetCPUSATKernelISAName((CPUSATKernelISA)isa);
+                    }
+
+                    ImGui::Combo("CPU SAT Kernels", &mCPUSATKernelISA, isaNames, CPUSATKernelISA_Count);
+                    if (!IsCPUSATKernelISASupported((CPUSATKernelISA)mCPUSATKernelISA))
+                    {
+                        ImGui::Text("Not supported by this CPU, using scalar kernels.");
+                    }
+                }
+
+                // Higher latency lets the GPU finish the readback before the CPU needs it, at the cost of a SAT that lags behind the depth buffer.
+                ImGui::SliderInt("Readback Latency (frames)", &mReadbackLatency, 0, kReadbackRingSize - 1);
+                ImGui::Checkbox("Pipelined CPU SAT", &mPipelineCPUSAT);
+                ImGui::Text("SAT latency: %d frame(s)", GetSATLatency());
+            }
             ImGui::SliderFloat("Focus Depth", &mFocusDepth, 0.0f, 10.0f);
         }
         ImGui::End();
@@ -326,17 +964,38 @@ public:
     {
         UpdateGUI();
 
-        // Reload any programs
-        mShaders.UpdatePrograms();
+        // Reload any programs. Everything drawn with the old ones is redrawn.
+        if (mShaders.UpdatePrograms())
+        {
+            InvalidateStage(PaintStage_Scene);
+        }
+
+        // Reallocate the backbuffers if the HDR SAT was switched on or off from the GUI
+        if (mBackbufferHDR != (mSATFormat == SATFormat_HDR))
+        {
+            Resize(mWindowWidth, mWindowHeight);
+        }
+
+        // Only redo the stages whose inputs changed
+        InvalidateChangedStages();
+        PaintStage firstStage = mFirstInvalidStage;
+        mFirstInvalidStage = PaintStage_GUI;
+        mLastRedoneStage = firstStage;
 
         // Render scene
-        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::RenderSceneStart], GL_TIMESTAMP);
-        if (*mSceneSP)
+        if (*mSceneSP && firstStage <= PaintStage_Scene)
         {
+            glQueryCounter(mGPUTimestampQueries[GPUTimestamps::RenderSceneStart], GL_TIMESTAMP);
             glBindFramebuffer(GL_FRAMEBUFFER, mBackbufferFBOMS);
             glViewport(0, 0, mBackbufferWidth, mBackbufferHeight);
 
-            glClearColor(100.0f / 255.0f, 149.0f / 255.0f, 237.0f / 255.0f, 1.0f);
+            // the clear color isn't encoded to sRGB, so the HDR backbuffer is cleared to the linear color
+            glm::vec3 clearColor = glm::vec3(100.0f / 255.0f, 149.0f / 255.0f, 237.0f / 255.0f);
+            if (mBackbufferHDR)
+            {
+                clearColor = glm::convertSRGBToLinear(clearColor);
+            }
+            glClearColor(clearColor.r, clearColor.g, clearColor.b, 1.0f);
             glClearDepth(0.0f);
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -429,12 +1088,14 @@ public:
             glUseProgram(0);
 
             glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            glQueryCounter(mGPUTimestampQueries[GPUTimestamps::RenderSceneEnd], GL_TIMESTAMP);
         }
-        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::RenderSceneEnd], GL_TIMESTAMP);
 
         // resolve multisampled backbuffer to singlesampled backbuffer
-        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::MultisampleResolveStart], GL_TIMESTAMP);
+        // the multisampled backbuffer is left as the scene rendered it, so this also undoes the last DoF.
+        if (firstStage <= PaintStage_DoF)
         {
+            glQueryCounter(mGPUTimestampQueries[GPUTimestamps::MultisampleResolveStart], GL_TIMESTAMP);
             glBindFramebuffer(GL_READ_FRAMEBUFFER, mBackbufferFBOMS);
             glBindFramebuffer(GL_DRAW_FRAMEBUFFER, mBackbufferFBOSS);
             glBlitFramebuffer(
@@ -442,252 +1103,322 @@ public:
                 0, 0, mBackbufferWidth, mBackbufferHeight,
                 GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT, GL_NEAREST);
             glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            glQueryCounter(mGPUTimestampQueries[GPUTimestamps::MultisampleResolveEnd], GL_TIMESTAMP);
         }
-        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::MultisampleResolveEnd], GL_TIMESTAMP);
 
-        if (mEnableDoF)
+        if (mEnableDoF && firstStage <= PaintStage_DoF)
         {
-            // Compute SAT for the rendered image
-            if (mUseCPUForSAT)
+            // Reallocate the SAT if its format or kernel was changed from the GUI, or the half resolution or separable DoF was switched on or off
+            if (mGPUSAT.GetFormat() != (SATFormat)mSATFormat || mGPUSAT.GetOrder() != DOF_KERNEL_ORDER(GetDoFKernel()) ||
+                (mHalfDoFFBO != 0) != IsHalfResolutionDoF() || (mSeparableDoFOutputTO != 0) != (GetDoFPass() == DoFPass_Separable))
             {
-                // Dumb CPU SAT. Mainly used as a reference.
-
-                // Readback backbuffer to SAT-ify it
-                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::ReadbackBackbufferStart]);
-                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::ReadbackBackbufferStart], GL_TIMESTAMP);
+                // a SAT being computed on the worker thread would be in the old format, so it's dropped.
+                if (mCPUSATJobInFlight)
                 {
-                    glBindFramebuffer(GL_READ_FRAMEBUFFER, mBackbufferFBOSS);
-                    glReadPixels(0, 0, mBackbufferWidth, mBackbufferHeight, GL_RGBA, GL_UNSIGNED_BYTE, &mCPUBackbufferReadback[0]);
-                    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+                    FinishCPUSATJob();
                 }
-                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::ReadbackBackbufferEnd], GL_TIMESTAMP);
-                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::ReadbackBackbufferEnd]);
 
+                ResizeSAT();
+            }
+
+            // Compute SAT for the rendered image, unless the last one is still the SAT of the backbuffer
+            bool computeSAT = firstStage <= PaintStage_SAT;
+            if (computeSAT && UseCPUForSAT())
+            {
+                // CPU SAT. Mainly used as a reference.
+
+                // In pipelined mode, the worker thread computed the SAT of the previous frame's readback
+                // while this frame's scene was being rendered. Collect it before issuing this frame's readback,
+                // since its readback buffer is still mapped.
+                int satUploadIndex = -1;
                 QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::ComputeSATStart]);
-                
-                // sum the rows
-                for (int row = 0; row < mBackbufferHeight; row++)
+                if (mCPUSATJobInFlight)
                 {
-                    glm::uvec4 first = glm::uvec4(mCPUBackbufferReadback[row * mBackbufferWidth + 0]);
-                    first = glm::uvec4(pow(glm::vec4(first) / 255.0f, glm::vec4(2.2f)) * 255.0f);
-                    mCPUSummedAreaTable[row * mSummedAreaTableWidth + 0] = first;
+                    FinishCPUSATJob();
 
-                    for (int col = 1; col < mBackbufferWidth; col++)
+                    if (mPipelineCPUSAT)
                     {
-                        glm::uvec4 readback = glm::uvec4(mCPUBackbufferReadback[row * mBackbufferWidth + col]);
-                        readback = glm::uvec4(pow(glm::vec4(readback) / 255.0f, glm::vec4(2.2f)) * 255.0f);
-                        mCPUSummedAreaTable[row * mSummedAreaTableWidth + col] = readback + mCPUSummedAreaTable[row * mSummedAreaTableWidth + (col - 1)];
+                        satUploadIndex = mCPUSATJobUploadIndex;
                     }
                 }
+                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::ComputeSATEnd]);
 
-                // sum the columns (gross memory access...)
-                for (int col = 0; col < mBackbufferWidth; col++)
+                // Readback backbuffer to SAT-ify it
+                // The read is issued into a PBO, and the readback from mReadbackLatency frames ago is consumed.
+                // With enough latency, the GPU has long finished that read so mapping it doesn't stall.
+                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::ReadbackBackbufferStart]);
+                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::ReadbackBackbufferStart], GL_TIMESTAMP);
+                int consumedReadbackIndex;
                 {
-                    for (int row = 1; row < mBackbufferHeight; row++)
+                    int issuedReadbackIndex = mNextReadbackIndex;
+                    mNextReadbackIndex = (mNextReadbackIndex + 1) % kReadbackRingSize;
+
+                    glBindFramebuffer(GL_READ_FRAMEBUFFER, mBackbufferFBOSS);
+                    glBindBuffer(GL_PIXEL_PACK_BUFFER, mReadbackPBOs[issuedReadbackIndex]);
+                    glReadPixels(0, 0, mBackbufferWidth, mBackbufferHeight, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+                    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+                    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+                    glDeleteSync(mReadbackFences[issuedReadbackIndex]);
+                    mReadbackFences[issuedReadbackIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+                    // Right after startup or a resize the older readbacks don't exist yet, so use the one just issued.
+                    consumedReadbackIndex = (issuedReadbackIndex + kReadbackRingSize - mReadbackLatency) % kReadbackRingSize;
+                    if (!mReadbackFences[consumedReadbackIndex])
                     {
-                        mCPUSummedAreaTable[row * mSummedAreaTableWidth + col] += mCPUSummedAreaTable[(row - 1) * mSummedAreaTableWidth + col];
+                        consumedReadbackIndex = issuedReadbackIndex;
                     }
+
+                    GLenum waitStatus;
+                    do
+                    {
+                        waitStatus = glClientWaitSync(mReadbackFences[consumedReadbackIndex], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+                    } while (waitStatus == GL_TIMEOUT_EXPIRED);
+
+                    glBindBuffer(GL_PIXEL_PACK_BUFFER, mReadbackPBOs[consumedReadbackIndex]);
+                    mCPUBackbufferReadback = (glm::u8vec4*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, mBackbufferWidth * mBackbufferHeight * sizeof(glm::u8vec4), GL_MAP_READ_BIT);
+                    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
                 }
-                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::ComputeSATEnd]);
+                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::ReadbackBackbufferEnd], GL_TIMESTAMP);
+                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::ReadbackBackbufferEnd]);
 
-                // Upload SAT back to GPU
-                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::SATUploadStart]);
-                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::SATUploadStart], GL_TIMESTAMP);
+                if (!mCPUBackbufferReadback)
                 {
-                    glBindTexture(GL_TEXTURE_2D, *mSummedAreaTableTO);
-                    for (int row = 0; row < mBackbufferHeight; row++)
-                    {
-                        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, row, mBackbufferWidth, 1, GL_RGBA_INTEGER, GL_UNSIGNED_INT, &mCPUSummedAreaTable[row * mSummedAreaTableWidth]);
-                    }
-                    glBindTexture(GL_TEXTURE_2D, 0);
+                    fprintf(stderr, "glMapBufferRange: failed to map the backbuffer readback\n");
                 }
-                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::SATUploadEnd], GL_TIMESTAMP);
-                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::SATUploadEnd]);
-            }
-            else
-            {
-                // GPU SAT
-                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::ComputeSATStart], GL_TIMESTAMP);
-                if (*mSummedAreaTableUpsweepSP && *mSummedAreaTableDownsweepSP && *mTransposeSummedAreaTableSP)
+                else
                 {
-                    enum SATPass {
-                        SATPass_Rows,
-                        SATPass_Cols,
-                        SATPass_Count
-                    };
+                    int newSATUploadIndex = AcquireSATUploadBuffer();
+                    mCPUSummedAreaTable = mSATUploadPointers[newSATUploadIndex];
 
-                    for (int pass = 0; pass < SATPass_Count; pass++)
+                    if (mPipelineCPUSAT)
                     {
-                        // Up-sweep
+                        // The worker thread computes the SAT while the DoF uses the previous frame's SAT,
+                        // and while the next frame is being rendered.
+                        if (!mCPUSATWorker)
                         {
-                            glUseProgram(*mSummedAreaTableUpsweepSP);
-
-                            glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
-
-                            if (pass == SATPass_Rows) {
-                                glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, &mBackbufferColorTOSS);
-                                glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedRowsTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA32UI);
-                                glUniform1i(SAT_READ_UINT_INPUT_UNIFORM_LOCATION, 0);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glBindTextures(SAT_UINT_INPUT_TEXTURE_BINDING, 1, &mSummedColsTO);
-                                glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedColsTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA32UI);
-                                glUniform1i(SAT_READ_UINT_INPUT_UNIFORM_LOCATION, 1);
-                            }
-
-                            glUniform1i(SAT_READ_WGSUM_UNIFORM_LOCATION, 0);
-
-                            if (pass == SATPass_Rows) {
-                                glDispatchCompute(mSummedAreaTableWidth / SAT_WORKGROUP_SIZE_X, mBackbufferHeight, 1);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glDispatchCompute(mSummedAreaTableHeight / SAT_WORKGROUP_SIZE_X, mBackbufferWidth, 1);
-                            }
-
-                            glBindTextures(SAT_INPUT_TEXTURE_BINDING, 1, NULL);
-                            glBindImageTextures(SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
-                            glUseProgram(0);
+                            mCPUSATWorker.reset(new CPUSATWorker());
                         }
 
-                        // Up-sweep WG sums
+                        if (mSATFormat == SATFormat_Compact)
                         {
-                            glUseProgram(*mSummedAreaTableUpsweepSP);
-
-                            glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
-
-                            if (pass == SATPass_Rows) {
-                                glBindTextures(SAT_UINT_INPUT_TEXTURE_BINDING, 1, &mSummedRowsTO);
-                                glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedRowsWGSumsTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA32UI);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glBindTextures(SAT_UINT_INPUT_TEXTURE_BINDING, 1, &mSummedColsTO);
-                                glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedColsWGSumsTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA32UI);
-                            }
-
-                            glUniform1i(SAT_READ_UINT_INPUT_UNIFORM_LOCATION, 0);
-                            glUniform1i(SAT_READ_WGSUM_UNIFORM_LOCATION, 1);
-
-                            if (pass == SATPass_Rows) {
-                                glDispatchCompute(1, mBackbufferHeight, 1);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glDispatchCompute(1, mBackbufferWidth, 1);
-                            }
-
-                            glBindTextures(SAT_UINT_INPUT_TEXTURE_BINDING, 1, NULL);
-                            glBindImageTextures(SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
-                            glUseProgram(0);
+                            mCPUSATWorker->Start(
+                                mCPUBackbufferReadback, mBackbufferWidth, mBackbufferHeight,
+                                (uint64_t*)mCPUSummedAreaTable, mBackbufferWidth);
                         }
-
-                        // Down-sweep WG sums
+                        else
                         {
-                            glUseProgram(*mSummedAreaTableDownsweepSP);
-
-                            glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
-
-                            if (pass == SATPass_Rows) {
-                                glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedRowsWGSumsTO, 0, GL_TRUE, 0, GL_READ_WRITE, GL_RGBA32UI);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedColsWGSumsTO, 0, GL_TRUE, 0, GL_READ_WRITE, GL_RGBA32UI);
-                            }
-
-                            glUniform1i(SAT_ADD_WGSUM_UNIFORM_LOCATION, 0);
-
-                            if (pass == SATPass_Rows) {
-                                glDispatchCompute(1, mBackbufferHeight, 1);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glDispatchCompute(1, mBackbufferWidth, 1);
-                            }
-
-                            glBindImageTextures(SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
-                            glUseProgram(0);
+                            mCPUSATWorker->Start(
+                                mCPUBackbufferReadback, mBackbufferWidth, mBackbufferHeight,
+                                mCPUSummedAreaTable, mBackbufferWidth,
+                                mUseCPUSATReference, (CPUSATKernelISA)mCPUSATKernelISA);
                         }
 
-                        // Down-sweep
+                        mCPUSATJobInFlight = true;
+                        mCPUSATJobReadbackIndex = consumedReadbackIndex;
+                        mCPUSATJobUploadIndex = newSATUploadIndex;
+                    }
+                    else
+                    {
+                        QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::ComputeSATStart]);
+                        if (mSATFormat == SATFormat_Compact)
                         {
-                            glUseProgram(*mSummedAreaTableDownsweepSP);
-
-                            glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
-
-                            if (pass == SATPass_Rows) {
-                                glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedRowsTO, 0, GL_TRUE, 0, GL_READ_WRITE, GL_RGBA32UI);
-                                glBindImageTexture(SAT_WGSUMS_IMAGE_BINDING, mSummedRowsWGSumsTO, 0, GL_TRUE, 0, GL_READ_ONLY, GL_RGBA32UI);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glBindImageTexture(SAT_OUTPUT_IMAGE_BINDING, mSummedColsTO, 0, GL_TRUE, 0, GL_READ_WRITE, GL_RGBA32UI);
-                                glBindImageTexture(SAT_WGSUMS_IMAGE_BINDING, mSummedColsWGSumsTO, 0, GL_TRUE, 0, GL_READ_ONLY, GL_RGBA32UI);
-                            }
-
-                            glUniform1i(SAT_ADD_WGSUM_UNIFORM_LOCATION, 1);
-
-                            if (pass == SATPass_Rows) {
-                                glDispatchCompute(mSummedAreaTableWidth / SAT_WORKGROUP_SIZE_X, mBackbufferHeight, 1);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glDispatchCompute(mSummedAreaTableHeight / SAT_WORKGROUP_SIZE_X, mBackbufferWidth, 1);
-                            }
-
-                            glBindImageTextures(SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
-                            glBindImageTextures(SAT_WGSUMS_IMAGE_BINDING, 1, NULL);
-                            glUseProgram(0);
+                            ComputeCompactSummedAreaTableCPU(
+                                mCPUBackbufferReadback, mBackbufferWidth, mBackbufferHeight,
+                                (uint64_t*)mCPUSummedAreaTable, mBackbufferWidth);
                         }
-
-                        // Transpose
+                        else if (mUseCPUSATReference)
                         {
-                            glUseProgram(*mTransposeSummedAreaTableSP);
-
-                            glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
-
-                            if (pass == SATPass_Rows) {
-                                glBindImageTexture(TRANSPOSE_SAT_INPUT_IMAGE_BINDING, mSummedRowsTO, 0, GL_TRUE, 0, GL_READ_ONLY, GL_RGBA32UI);
-                                glBindImageTexture(TRANSPOSE_SAT_OUTPUT_IMAGE_BINDING, mSummedColsTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA32UI);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glBindImageTexture(TRANSPOSE_SAT_INPUT_IMAGE_BINDING, mSummedColsTO, 0, GL_TRUE, 0, GL_READ_ONLY, GL_RGBA32UI);
-                                glBindImageTexture(TRANSPOSE_SAT_OUTPUT_IMAGE_BINDING, *mSummedAreaTableTO, 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA32UI);
-                            }
-
-                            if (pass == SATPass_Rows) {
-                                glDispatchCompute(mSummedAreaTableWidth / TRANSPOSE_SAT_WORKGROUP_SIZE_X, mSummedAreaTableHeight / TRANSPOSE_SAT_WORKGROUP_SIZE_X, 1);
-                            }
-                            else if (pass == SATPass_Cols) {
-                                glDispatchCompute(mSummedAreaTableHeight / TRANSPOSE_SAT_WORKGROUP_SIZE_X, mSummedAreaTableWidth / TRANSPOSE_SAT_WORKGROUP_SIZE_X, 1);
-                            }
-
-                            glBindImageTextures(TRANSPOSE_SAT_INPUT_IMAGE_BINDING, 1, NULL);
-                            glBindImageTextures(TRANSPOSE_SAT_OUTPUT_IMAGE_BINDING, 1, NULL);
-                            glUseProgram(0);
+                            ComputeSummedAreaTableCPUReference(
+                                mCPUBackbufferReadback, mBackbufferWidth, mBackbufferHeight,
+                                mCPUSummedAreaTable, mBackbufferWidth);
                         }
+                        else
+                        {
+                            ComputeSummedAreaTableCPU(
+                                mCPUBackbufferReadback, mBackbufferWidth, mBackbufferHeight,
+                                mCPUSummedAreaTable, mBackbufferWidth,
+                                (CPUSATKernelISA)mCPUSATKernelISA);
+                        }
+                        QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::ComputeSATEnd]);
+
+                        glBindBuffer(GL_PIXEL_PACK_BUFFER, mReadbackPBOs[consumedReadbackIndex]);
+                        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+                        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+                        satUploadIndex = newSATUploadIndex;
+                    }
+
+                    mCPUBackbufferReadback = NULL;
+                    mCPUSummedAreaTable = NULL;
+                }
+
+                // Upload SAT back to GPU
+                // The SAT was written straight into the unpack buffer, so the whole upload is one call.
+                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::SATUploadStart]);
+                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::SATUploadStart], GL_TIMESTAMP);
+                if (satUploadIndex != -1)
+                {
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mSATUploadPBOs[satUploadIndex]);
+                    glBindTexture(GL_TEXTURE_2D, mGPUSAT.GetSATTexture());
+                    // the compact SAT's 64-bit integers are uploaded as their low and high halves
+                    GLenum uploadFormat = mSATFormat == SATFormat_Compact ? GL_RG_INTEGER : GL_RGBA_INTEGER;
+                    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mBackbufferWidth, mBackbufferHeight, uploadFormat, GL_UNSIGNED_INT, 0);
+                    glBindTexture(GL_TEXTURE_2D, 0);
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+                    mSATUploadFences[satUploadIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                }
+                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::SATUploadEnd], GL_TIMESTAMP);
+                QueryPerformanceCounter(&mCPUTimestampQueryResults[CPUTimestamps::SATUploadEnd]);
+            }
+            else if (computeSAT)
+            {
+                // GPU SAT
+                int timestampStart = GPUTimestamps::ComputeSATUpDownSweepStart + mSATAlgorithm * 2;
+                glQueryCounter(mGPUTimestampQueries[timestampStart], GL_TIMESTAMP);
+                int satLevels = GetDoFSATLevels();
+                if (satLevels & 1)
+                {
+                    mGPUSAT.Compute(mBackbufferColorTOSS, (SATAlgorithm)mSATAlgorithm, (SATColumnPass)mSATColumnPass);
+                }
+                for (int level = 1; level < DOF_SAT_LEVEL_COUNT; level++)
+                {
+                    if (satLevels & (1 << level))
+                    {
+                        mCoarseGPUSATs[level - 1].Compute(mBackbufferColorTOSS, (SATAlgorithm)mSATAlgorithm, (SATColumnPass)mSATColumnPass);
                     }
                 }
-                glQueryCounter(mGPUTimestampQueries[GPUTimestamps::ComputeSATEnd], GL_TIMESTAMP);
+                glQueryCounter(mGPUTimestampQueries[timestampStart + 1], GL_TIMESTAMP);
             }
 
             // Apply DoF-blur to scene
             glQueryCounter(mGPUTimestampQueries[GPUTimestamps::DOFBlurStart], GL_TIMESTAMP);
-            if (*mDepthOfFieldSP)
+            Camera& mainCamera = mScene->Cameras[mScene->MainCameraID];
+            SATFormat satFormat = mGPUSAT.GetFormat();
+            GLuint depthOfFieldSP = *mDepthOfFieldSP[satFormat];
+            GLuint uniformTilesSP = *mDepthOfFieldUniformTilesSP[satFormat];
+            GLuint mixedTilesSP = *mDepthOfFieldMixedTilesSP[satFormat];
+            GLuint computeSP = mDepthOfFieldComputeSP[satFormat] ? *mDepthOfFieldComputeSP[satFormat] : 0;
+            GLuint halfSP = mDepthOfFieldHalfSP[satFormat] ? *mDepthOfFieldHalfSP[satFormat] : 0;
+            GLuint upsampleSP = *mDepthOfFieldUpsampleSP;
+            GLuint separableSP = *mDepthOfFieldSeparableSP;
+            GLuint separableCopySP = *mDepthOfFieldSeparableCopySP;
+            // falls back to the fullscreen DoF if the tile, compute or half resolution programs failed to compile,
+            // and to the plain tiles if the separable programs did.
+            int dofPass = GetDoFPass();
+            bool useSeparableDoF = dofPass == DoFPass_Separable && separableSP && separableCopySP;
+            bool useDoFTiles = (dofPass == DoFPass_Tiles || dofPass == DoFPass_Separable) && uniformTilesSP && mixedTilesSP &&
+                mDoFTiles.Classify(mBackbufferDepthTOSS, mainCamera.ZNear, mFocusDepth, useSeparableDoF ? GetSeparableDoFMaxRadius() : 0);
+            bool useDoFCompute = dofPass == DoFPass_Compute && computeSP;
+            bool useHalfResDoF = IsHalfResolutionDoF() && halfSP && upsampleSP;
+            if (useDoFTiles || useDoFCompute || useHalfResDoF || depthOfFieldSP)
             {
                 // ensure the computed SAT is available to the DoF shader
                 glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
 
                 glBindFramebuffer(GL_FRAMEBUFFER, mBackbufferFBOSS);
-                glUseProgram(*mDepthOfFieldSP);
                 glBindVertexArray(mNullVAO);
-                glBindTextures(DOF_SAT_TEXTURE_BINDING, 1, &*mSummedAreaTableTO);
+                GLuint satTO = mGPUSAT.GetSATTexture();
+                GLuint halfSATTO = mCoarseGPUSATs[0].GetSATTexture();
+                GLuint quarterSATTO = mCoarseGPUSATs[1].GetSATTexture();
+                glBindTextures(DOF_SAT_TEXTURE_BINDING, 1, &satTO);
+                glBindTextures(DOF_HALF_SAT_TEXTURE_BINDING, 1, &halfSATTO);
+                glBindTextures(DOF_QUARTER_SAT_TEXTURE_BINDING, 1, &quarterSATTO);
                 glBindTextures(DOF_DEPTH_TEXTURE_BINDING, 1, &mBackbufferDepthTOSS);
                 glEnable(GL_FRAMEBUFFER_SRGB);
 
-                Camera& mainCamera = mScene->Cameras[mScene->MainCameraID];
+                // the CPU and HDR SATs are inclusive
+                int satInclusive = UseCPUForSAT() || satFormat == SATFormat_HDR ? 1 : 0;
 
-                glUniform1f(DOF_ZNEAR_UNIFORM_LOCATION, mainCamera.ZNear);
-                glUniform1f(DOF_FOCUS_UNIFORM_LOCATION, mFocusDepth);
-            
-                glDrawArrays(GL_TRIANGLES, 0, 3);
+                auto useDepthOfFieldProgram = [&](GLuint sp)
+                {
+                    // only dof.frag has the kernel uniform, the others could alias their samplers with it
+                    bool hasKernel = sp == depthOfFieldSP || sp == uniformTilesSP || sp == mixedTilesSP;
+                    glUseProgram(sp);
+                    glUniform1f(DOF_ZNEAR_UNIFORM_LOCATION, mainCamera.ZNear);
+                    glUniform1f(DOF_FOCUS_UNIFORM_LOCATION, mFocusDepth);
+                    glUniform1i(DOF_SAT_LEVELS_UNIFORM_LOCATION, GetDoFSATLevels());
+                    glUniform1i(DOF_SAT_INCLUSIVE_UNIFORM_LOCATION, satInclusive);
+                    if (hasKernel)
+                    {
+                        glUniform1i(DOF_KERNEL_UNIFORM_LOCATION, GetDoFKernel());
+                    }
+                };
+
+                if (useDoFCompute)
+                {
+                    // the backbuffer is written in place, like the other passes, but as an image
+                    useDepthOfFieldProgram(computeSP);
+                    glBindImageTexture(DOF_OUTPUT_IMAGE_BINDING, mBackbufferColorViewTOSS, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+                    glDispatchCompute((mBackbufferWidth + DOF_TILE_SIZE - 1) / DOF_TILE_SIZE, (mBackbufferHeight + DOF_TILE_SIZE - 1) / DOF_TILE_SIZE, 1);
+                    glBindImageTextures(DOF_OUTPUT_IMAGE_BINDING, 1, NULL);
+
+                    // the GUI is drawn over the backbuffer next, then it's blitted to the window
+                    glMemoryBarrier(GL_FRAMEBUFFER_BARRIER_BIT);
+                }
+                else if (useHalfResDoF)
+                {
+                    // blur the blocks into the half resolution buffers
+                    glBindFramebuffer(GL_FRAMEBUFFER, mHalfDoFFBO);
+                    glViewport(0, 0, (mBackbufferWidth + 1) / 2, (mBackbufferHeight + 1) / 2);
+                    useDepthOfFieldProgram(halfSP);
+                    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+                    // then blend them over the pixels out of focus
+                    glBindFramebuffer(GL_FRAMEBUFFER, mBackbufferFBOSS);
+                    glViewport(0, 0, mBackbufferWidth, mBackbufferHeight);
+                    glBindTextures(DOF_HALF_COLOR_TEXTURE_BINDING, 1, &mHalfDoFColorTO);
+                    glBindTextures(DOF_HALF_DEPTH_TEXTURE_BINDING, 1, &mHalfDoFDepthTO);
+                    // the upsample only has the ZNear and Focus uniforms, the others could alias its samplers
+                    glUseProgram(upsampleSP);
+                    glUniform1f(DOF_ZNEAR_UNIFORM_LOCATION, mainCamera.ZNear);
+                    glUniform1f(DOF_FOCUS_UNIFORM_LOCATION, mFocusDepth);
+                    glDrawArrays(GL_TRIANGLES, 0, 3);
+                    glBindTextures(DOF_HALF_COLOR_TEXTURE_BINDING, 1, NULL);
+                    glBindTextures(DOF_HALF_DEPTH_TEXTURE_BINDING, 1, NULL);
+                }
+                else if (useDoFTiles)
+                {
+                    if (useSeparableDoF)
+                    {
+                        // the separable tiles read the pixels around them, which the DoF overwrites in place,
+                        // so they're blurred into another texture, then only they are copied over the backbuffer
+                        glUseProgram(separableSP);
+                        glUniform1i(DOF_SAT_INCLUSIVE_UNIFORM_LOCATION, satInclusive);
+                        glBindTextures(DOF_SEPARABLE_COLOR_TEXTURE_BINDING, 1, &mBackbufferColorTOSS);
+                        glBindImageTexture(DOF_OUTPUT_IMAGE_BINDING, mSeparableDoFOutputTO, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+                        mDoFTiles.Dispatch(DOF_TILE_CLASS_SEPARABLE);
+                        glBindImageTextures(DOF_OUTPUT_IMAGE_BINDING, 1, NULL);
+                        glBindTextures(DOF_SEPARABLE_COLOR_TEXTURE_BINDING, 1, NULL);
+
+                        glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+
+                        // already encoded to sRGB
+                        glDisable(GL_FRAMEBUFFER_SRGB);
+                        glUseProgram(separableCopySP);
+                        glBindTextures(DOF_SEPARABLE_OUTPUT_TEXTURE_BINDING, 1, &mSeparableDoFOutputTO);
+                        mDoFTiles.Draw(DOF_TILE_CLASS_SEPARABLE);
+                        glBindTextures(DOF_SEPARABLE_OUTPUT_TEXTURE_BINDING, 1, NULL);
+                        glEnable(GL_FRAMEBUFFER_SRGB);
+                    }
+
+                    // the DoF is drawn in place, so the in-focus tiles are just left as they are
+                    useDepthOfFieldProgram(uniformTilesSP);
+                    mDoFTiles.Draw(DOF_TILE_CLASS_UNIFORM);
+                    useDepthOfFieldProgram(mixedTilesSP);
+                    mDoFTiles.Draw(DOF_TILE_CLASS_MIXED);
+                }
+                else
+                {
+                    useDepthOfFieldProgram(depthOfFieldSP);
+                    glDrawArrays(GL_TRIANGLES, 0, 3);
+                }
             
                 glDisable(GL_FRAMEBUFFER_SRGB);
                 glBindTextures(DOF_SAT_TEXTURE_BINDING, 1, NULL);
+                glBindTextures(DOF_HALF_SAT_TEXTURE_BINDING, 1, NULL);
+                glBindTextures(DOF_QUARTER_SAT_TEXTURE_BINDING, 1, NULL);
                 glBindTextures(DOF_DEPTH_TEXTURE_BINDING, 1, NULL);
                 glBindVertexArray(0);
                 glUseProgram(0);
@@ -697,17 +1428,22 @@ public:
         
         } // endif enable DOF
 
-        // Render GUI
-        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::RenderGUIStart], GL_TIMESTAMP);
+        // Blit to window's framebuffer
+        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::BlitToWindowStart], GL_TIMESTAMP);
+        if (mBackbufferHDR)
         {
-            glBindFramebuffer(GL_FRAMEBUFFER, mBackbufferFBOSS);
-            ImGui::Render();
+            // the HDR backbuffer is encoded to sRGB as it's drawn
             glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            glViewport(0, 0, mWindowWidth, mWindowHeight);
+            glUseProgram(*mPresentSP);
+            glBindVertexArray(mNullVAO);
+            glBindTextures(PRESENT_COLOR_TEXTURE_BINDING, 1, &mBackbufferColorTOSS);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+            glBindTextures(PRESENT_COLOR_TEXTURE_BINDING, 1, NULL);
+            glBindVertexArray(0);
+            glUseProgram(0);
         }
-        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::RenderGUIEnd], GL_TIMESTAMP);
-
-        // Blit to window's framebuffer
-        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::BlitToWindowStart], GL_TIMESTAMP);
+        else
         {
             glBindFramebuffer(GL_READ_FRAMEBUFFER, mBackbufferFBOSS);
             glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0); // default FBO
@@ -722,6 +1458,15 @@ public:
         }
         glQueryCounter(mGPUTimestampQueries[GPUTimestamps::BlitToWindowEnd], GL_TIMESTAMP);
 
+        // Render GUI
+        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::RenderGUIStart], GL_TIMESTAMP);
+        {
+            // the GUI is drawn over the window rather than the backbuffer, so the backbuffer can be reused by the next frame
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            ImGui::Render();
+        }
+        glQueryCounter(mGPUTimestampQueries[GPUTimestamps::RenderGUIEnd], GL_TIMESTAMP);
+
         mFirstFrame = false;
     }
 
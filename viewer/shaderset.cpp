@@ -97,7 +97,7 @@ void ShaderSet::SetPreamble(const std::string& preamble)
     mPreamble = preamble;
 }
 
-GLuint* ShaderSet::AddProgram(const std::vector<std::pair<std::string, GLenum>>& typedShaders)
+GLuint* ShaderSet::AddProgram(const std::vector<std::pair<std::string, GLenum>>& typedShaders, const std::string& defines)
 {
     std::vector<const ShaderNameTypePair*> shaderNameTypes;
         
@@ -106,6 +106,7 @@ GLuint* ShaderSet::AddProgram(const std::vector<std::pair<std::string, GLenum>>&
     {
         ShaderNameTypePair tmpShaderNameType;
         std::tie(tmpShaderNameType.Name, tmpShaderNameType.Type) = shaderNameType;
+        tmpShaderNameType.Defines = defines;
 
         auto foundShader = mShaders.emplace(std::move(tmpShaderNameType), Shader{}).first;
         if (!foundShader->second.Handle)
@@ -137,8 +138,10 @@ GLuint* ShaderSet::AddProgram(const std::vector<std::pair<std::string, GLenum>>&
     return &foundProgram->second.PublicHandle;
 }
 
-void ShaderSet::UpdatePrograms()
+bool ShaderSet::UpdatePrograms()
 {
+    bool relinked = false;
+
     // find all shaders with updated timestamps
     std::set<std::pair<const ShaderNameTypePair, Shader>*> updatedShaders;
     for (std::pair<const ShaderNameTypePair, Shader>& shader : mShaders)
@@ -157,6 +160,8 @@ void ShaderSet::UpdatePrograms()
         // the #line prefix ensures error messages have the right line number for their file
         // the #line directive also allows specifying a "file name" number, which makes it possible to identify which file the error came from.
         std::string version = "#version " + mVersion + "\n";
+
+        std::string defines = shader->first.Defines;
         
         std::string preamble_hash = std::to_string((int32_t)std::hash<std::string>()("preamble"));
         std::string premable = "#line 1 " + preamble_hash + "\n" + 
@@ -168,11 +173,13 @@ void ShaderSet::UpdatePrograms()
 
         const char* strings[] = {
             version.c_str(),
+            defines.c_str(),
             premable.c_str(),
             source.c_str()
         };
         GLint lengths[] = {
             (GLint)version.length(),
+            (GLint)defines.length(),
             (GLint)premable.length(),
             (GLint)source.length()
         };
@@ -241,6 +248,7 @@ void ShaderSet::UpdatePrograms()
         if (programNeedsRelink && canRelink)
         {
             glLinkProgram(program.second.InternalHandle);
+            relinked = true;
 
             GLint logLength;
             glGetProgramiv(program.second.InternalHandle, GL_INFO_LOG_LENGTH, &logLength);
@@ -304,6 +312,8 @@ void ShaderSet::UpdatePrograms()
             }
         }
     }
+
+    return relinked;
 }
 
 void ShaderSet::SetPreambleFile(const std::string& preambleFilename)
@@ -311,7 +321,7 @@ void ShaderSet::SetPreambleFile(const std::string& preambleFilename)
     SetPreamble(ShaderStringFromFile(preambleFilename.c_str()));
 }
 
-GLuint* ShaderSet::AddProgramFromExts(const std::vector<std::string>& shaders)
+GLuint* ShaderSet::AddProgramFromExts(const std::vector<std::string>& shaders, const std::string& defines)
 {
     std::vector<std::pair<std::string, GLenum>> typedShaders;
     for (const std::string& shader : shaders)
@@ -343,5 +353,5 @@ GLuint* ShaderSet::AddProgramFromExts(const std::vector<std::string>& shaders)
         typedShaders.emplace_back(shader, shaderType);
     }
 
-    return AddProgram(typedShaders);
+    return AddProgram(typedShaders, defines);
 }
@@ -14,12 +14,13 @@ class ShaderSet
     using ShaderHandle = GLuint;
     using ProgramHandle = GLuint;
 
-    // filename and shader type
+    // filename, shader type, and the defines it's compiled with
     struct ShaderNameTypePair
     {
         std::string Name;
         GLenum Type;
-        bool operator<(const ShaderNameTypePair& rhs) const { return std::tie(Name, Type) < std::tie(rhs.Name, rhs.Type); }
+        std::string Defines;
+        bool operator<(const ShaderNameTypePair& rhs) const { return std::tie(Name, Type, Defines) < std::tie(rhs.Name, rhs.Type, rhs.Defines); }
     };
 
     // Shader in the ShaderSet system
@@ -71,10 +72,13 @@ public:
 
     // list of (file name, shader type) pairs
     // eg: AddProgram({ {"foo.vert", GL_VERTEX_SHADER}, {"bar.frag", GL_FRAGMENT_SHADER} });
-    GLuint* AddProgram(const std::vector<std::pair<std::string, GLenum>>& typedShaders);
+    // The defines are inserted before the preamble of each shader (eg: "#define FOO 1\n")
+    // The same file compiled with different defines is a different shader, so one file can be specialized into many programs.
+    GLuint* AddProgram(const std::vector<std::pair<std::string, GLenum>>& typedShaders, const std::string& defines = "");
 
     // Polls the timestamps of all the shaders and recompiles/relinks them if they changed
-    void UpdatePrograms();
+    // Returns whether any program was relinked (successfully or not), so what was drawn with the old programs can be redrawn.
+    bool UpdatePrograms();
 
     // Convenience to add shaders based on extension file naming conventions
     // vertex shader: .vert
@@ -84,5 +88,5 @@ public:
     // tessellation evaluation shader: .tese
     // compute shader: .comp
     // eg: AddProgramFromExts({"foo.vert", "bar.frag"});
-    GLuint* AddProgramFromExts(const std::vector<std::string>& shaders);
+    GLuint* AddProgramFromExts(const std::vector<std::string>& shaders, const std::string& defines = "");
 };
\ No newline at end of file